@@ -110,6 +110,7 @@ struct CommandListCoreFamily : CommandListImp {
                                  ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                     NEO::GraphicsAllocation *srcAllocation,
+                                    size_t offset,
                                     size_t size,
                                     bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
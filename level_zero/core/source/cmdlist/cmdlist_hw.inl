@@ -1054,7 +1054,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                       NEO::GraphicsAllocation *srcAllocation,
-                                                                      size_t size, bool flushHost) {
+                                                                      size_t offset, size_t size, bool flushHost) {
 
     size_t middleElSize = sizeof(uint32_t) * 4;
     uintptr_t rightSize = size % middleElSize;
@@ -1064,8 +1064,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         isStateless = true;
     }
 
-    uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-    uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+    uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + offset);
+    uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + offset);
     ze_result_t ret = ZE_RESULT_ERROR_UNKNOWN;
     if (isCopyOnly()) {
         return appendMemoryCopyBlit(dstAddress, dstAllocation, 0u,
@@ -72,7 +72,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                     NEO::GraphicsAllocation *srcAllocation,
-                                    size_t size, bool flushHost) override;
+                                    size_t offset, size_t size, bool flushHost) override;
 
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) override;
 
@@ -131,7 +131,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool preferCopyThroughLockedPtr(NEO::SvmAllocationData *dstAlloc, bool dstFound, NEO::SvmAllocationData *srcAlloc, bool srcFound, size_t size);
     bool isAllocUSMDeviceMemory(NEO::SvmAllocationData *alloc, bool allocFound);
     ze_result_t performCpuMemcpy(void *dstptr, const void *srcptr, size_t size, bool isDstDeviceMemory, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
-    void *obtainLockedPtrFromDevice(void *ptr, size_t size);
+    void *obtainLockedPtrFromDevice(void *ptr, size_t size, NEO::GraphicsAllocation *&alloc);
 
   protected:
     std::atomic<bool> barrierCalled{false};
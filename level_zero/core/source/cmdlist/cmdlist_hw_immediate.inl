@@ -331,7 +331,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                                NEO::GraphicsAllocation *srcAllocation,
-                                                                               size_t size, bool flushHost) {
+                                                                               size_t offset, size_t size, bool flushHost) {
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -340,8 +340,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
     ze_result_t ret;
 
     if (this->isAppendSplitNeeded(dstAllocation->getMemoryPool(), srcAllocation->getMemoryPool(), size)) {
-        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + offset);
+        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + offset);
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
@@ -349,7 +349,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
             return this->appendSignalEvent(hSignalEventParam);
         });
     } else {
-        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, size, flushHost);
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, offset, size, flushHost);
     }
     return flushImmediate(ret, false);
 }
@@ -512,11 +512,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(void
 
     const void *cpuMemcpySrcPtr = nullptr;
     void *cpuMemcpyDstPtr = nullptr;
+    NEO::GraphicsAllocation *lockedAlloc = nullptr;
     if (isDstDeviceMemory) {
         cpuMemcpySrcPtr = srcptr;
-        cpuMemcpyDstPtr = obtainLockedPtrFromDevice(dstptr, size);
+        cpuMemcpyDstPtr = obtainLockedPtrFromDevice(dstptr, size, lockedAlloc);
     } else {
-        cpuMemcpySrcPtr = obtainLockedPtrFromDevice(const_cast<void *>(srcptr), size);
+        cpuMemcpySrcPtr = obtainLockedPtrFromDevice(const_cast<void *>(srcptr), size, lockedAlloc);
         cpuMemcpyDstPtr = dstptr;
     }
 
@@ -535,6 +536,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(void
 
     memcpy_s(cpuMemcpyDstPtr, size, cpuMemcpySrcPtr, size);
 
+    if (isDstDeviceMemory && (this->csr->getType() != NEO::CommandStreamReceiverType::CSR_HW)) {
+        auto offset = ptrDiff(dstptr, lockedAlloc->getGpuAddress());
+        lockedAlloc->setAubWritableRange(offset, size, NEO::GraphicsAllocation::allBanks);
+        lockedAlloc->setTbxWritableRange(offset, size, NEO::GraphicsAllocation::allBanks);
+    }
+
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
         signalEvent->hostSignal();
@@ -543,16 +550,16 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(void
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-void *CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainLockedPtrFromDevice(void *ptr, size_t size) {
+void *CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainLockedPtrFromDevice(void *ptr, size_t size, NEO::GraphicsAllocation *&alloc) {
     NEO::SvmAllocationData *allocData = nullptr;
     auto allocFound = this->device->getDriverHandle()->findAllocationDataForRange(ptr, size, &allocData);
     UNRECOVERABLE_IF(!allocFound);
 
-    auto alloc = allocData->gpuAllocations.getGraphicsAllocation(this->device->getRootDeviceIndex());
+    alloc = allocData->gpuAllocations.getGraphicsAllocation(this->device->getRootDeviceIndex());
     if (!alloc->isLocked()) {
         this->device->getDriverHandle()->getMemoryManager()->lockResource(alloc);
     }
-    auto gpuAddress = allocData->gpuAllocations.getGraphicsAllocation(this->device->getRootDeviceIndex())->getGpuAddress();
+    auto gpuAddress = alloc->getGpuAddress();
     auto offset = ptrDiff(ptr, gpuAddress);
     return ptrOffset(alloc->getLockedPtr(), offset);
 }
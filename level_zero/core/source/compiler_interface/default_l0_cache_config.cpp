@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,12 @@ NEO::CompilerCacheConfig getDefaultL0CompilerCacheConfig() {
     std::unique_ptr<NEO::SettingsReader> settingsReader(NEO::SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(L0_CACHE_LOCATION));
 
+    std::string maxSizeKeyName = registryPath;
+    maxSizeKeyName += "l0_c_cache_max_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(maxSizeKeyName), static_cast<int64_t>(NEO::CompilerCacheConfig::defaultCacheSize)));
+
+    ret.memoryTierSize = NEO::CompilerCacheConfig::defaultMemoryTierSize;
+    ret.mmapThreshold = NEO::CompilerCacheConfig::defaultMmapThreshold;
     ret.cacheFileExtension = ".l0_c_cache";
 
     return ret;
@@ -9,8 +9,11 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -67,6 +70,51 @@ void BcsSplit::releaseResources() {
     }
 }
 
+size_t BcsSplit::getChunkSize(size_t totalSize, size_t engineCount) {
+    size_t maxChunkSize = defaultMaxChunkSize;
+    if (NEO::DebugManager.flags.SplitBcsChunkSize.get() > 0) {
+        maxChunkSize = static_cast<size_t>(NEO::DebugManager.flags.SplitBcsChunkSize.get());
+    }
+    // Smaller copies are still spread over all engines
+    auto evenSplitSize = (totalSize + engineCount - 1) / engineCount;
+    return std::max(std::min(maxChunkSize, evenSplitSize), static_cast<size_t>(1u));
+}
+
+std::vector<BcsSplit::Chunk> BcsSplit::scheduleChunks(size_t totalSize, size_t chunkSize, std::vector<uint64_t> enginesLoad) {
+    std::vector<Chunk> chunks;
+    if (enginesLoad.empty() || chunkSize == 0u) {
+        return chunks;
+    }
+    chunks.reserve((totalSize + chunkSize - 1) / chunkSize);
+
+    for (size_t offset = 0u; offset < totalSize; offset += chunkSize) {
+        auto leastLoadedEngine = std::min_element(enginesLoad.begin(), enginesLoad.end());
+
+        Chunk chunk;
+        chunk.engineIndex = static_cast<size_t>(leastLoadedEngine - enginesLoad.begin());
+        chunk.offset = offset;
+        chunk.size = std::min(chunkSize, totalSize - offset);
+        chunks.push_back(chunk);
+
+        *leastLoadedEngine += chunk.size;
+    }
+    return chunks;
+}
+
+std::vector<uint64_t> BcsSplit::getEnginesLoad() {
+    // Work already queued on an engine is estimated as one maximal chunk per not completed task
+    std::vector<uint64_t> enginesLoad;
+    enginesLoad.reserve(this->cmdQs.size());
+    for (auto cmdQ : this->cmdQs) {
+        auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
+        auto taskCount = csr->peekTaskCount();
+        auto completedTaskCount = *csr->getTagAddress();
+        auto pendingTasks = (taskCount > completedTaskCount) ? taskCount - completedTaskCount : 0u;
+        enginesLoad.push_back(static_cast<uint64_t>(pendingTasks) * defaultMaxChunkSize);
+    }
+    return enginesLoad;
+}
+
 BcsSplit::Events::~Events() {
     this->releaseResources();
 }
@@ -70,23 +70,30 @@ struct BcsSplit {
         auto subcopyEventIndex = markerEventIndex * this->cmdQs.size();
         StackVec<ze_event_handle_t, 4> eventHandles;
 
-        auto totalSize = size;
-        auto engineCount = this->cmdQs.size();
-        for (size_t i = 0; i < this->cmdQs.size(); i++) {
-            auto localSize = totalSize / engineCount;
-            auto localDstPtr = ptrOffset(dstptr, size - totalSize);
-            auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
-
-            auto eventHandle = this->events.subcopy[subcopyEventIndex + i]->toHandle();
-            result = appendCall(localDstPtr, localSrcPtr, localSize, eventHandle);
-            cmdList->executeCommandListImmediateImpl(true, this->cmdQs[i]);
-            eventHandles.push_back(eventHandle);
-
-            totalSize -= localSize;
-            engineCount--;
+        auto chunks = scheduleChunks(size, getChunkSize(size, this->cmdQs.size()), getEnginesLoad());
+
+        // Chunks on the same engine execute in order, so only the last one of each engine signals its subcopy event
+        StackVec<size_t, 4> lastChunkOnEngine;
+        lastChunkOnEngine.resize(this->cmdQs.size(), chunks.size());
+        for (size_t i = 0; i < chunks.size(); i++) {
+            lastChunkOnEngine[chunks[i].engineIndex] = i;
+        }
+
+        for (size_t i = 0; i < chunks.size(); i++) {
+            const auto &chunk = chunks[i];
+            auto localDstPtr = ptrOffset(dstptr, chunk.offset);
+            auto localSrcPtr = ptrOffset(srcptr, chunk.offset);
+
+            ze_event_handle_t eventHandle = nullptr;
+            if (lastChunkOnEngine[chunk.engineIndex] == i) {
+                eventHandle = this->events.subcopy[subcopyEventIndex + chunk.engineIndex]->toHandle();
+                eventHandles.push_back(eventHandle);
+            }
+            result = appendCall(localDstPtr, localSrcPtr, chunk.size, eventHandle);
+            cmdList->executeCommandListImmediateImpl(true, this->cmdQs[chunk.engineIndex]);
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(this->cmdQs.size()), eventHandles.data());
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data());
         cmdList->appendSignalEvent(this->events.marker[markerEventIndex]->toHandle());
 
         if (hSignalEvent) {
@@ -96,6 +103,18 @@ struct BcsSplit {
         return result;
     }
 
+    struct Chunk {
+        size_t engineIndex = 0u;
+        size_t offset = 0u;
+        size_t size = 0u;
+    };
+
+    static constexpr size_t defaultMaxChunkSize = 64 * MemoryConstants::megaByte;
+
+    static size_t getChunkSize(size_t totalSize, size_t engineCount);
+    static std::vector<Chunk> scheduleChunks(size_t totalSize, size_t chunkSize, std::vector<uint64_t> enginesLoad);
+    std::vector<uint64_t> getEnginesLoad();
+
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
 
@@ -153,6 +153,7 @@ DriverHandleImp::~DriverHandleImp() {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
+            this->svmAllocsManager->trimUSMHostAllocCaches();
         }
     }
 
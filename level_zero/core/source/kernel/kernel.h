@@ -47,7 +47,15 @@ struct KernelImmutableData {
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation ? isaGraphicsAllocation.get() : isaParentAllocation; }
+    uint64_t getIsaOffsetInParentAllocation() const { return static_cast<uint64_t>(isaSubAllocationOffset); }
+
+    // Makes kernel ISA a sub-allocation of an allocation shared by all kernels of a module, must be set before initialize()
+    void setIsaParentAllocation(NEO::GraphicsAllocation *allocation, size_t offset, size_t size) {
+        isaParentAllocation = allocation;
+        isaSubAllocationOffset = offset;
+        isaSubAllocationSize = size;
+    }
 
     const uint8_t *getCrossThreadDataTemplate() const { return crossThreadDataTemplate.get(); }
 
@@ -79,6 +87,9 @@ struct KernelImmutableData {
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::GraphicsAllocation *isaParentAllocation = nullptr;
+    size_t isaSubAllocationOffset = 0;
+    size_t isaSubAllocationSize = 0;
 
     uint32_t crossThreadDataSize = 0;
     std::unique_ptr<uint8_t[]> crossThreadDataTemplate = nullptr;
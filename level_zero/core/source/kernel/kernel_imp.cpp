@@ -76,11 +76,16 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
     UNRECOVERABLE_IF(!kernelInfo->heapInfo.pKernelHeap);
     const auto allocType = internalKernel ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
-        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
-    UNRECOVERABLE_IF(allocation == nullptr);
+    if (isaParentAllocation == nullptr) {
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+        UNRECOVERABLE_IF(allocation == nullptr);
 
-    isaGraphicsAllocation.reset(allocation);
+        isaGraphicsAllocation.reset(allocation);
+    } else {
+        UNRECOVERABLE_IF(isaParentAllocation->getAllocationType() != allocType);
+        UNRECOVERABLE_IF(isaSubAllocationSize < kernelIsaSize);
+    }
 
     if (neoDevice->getDebugger() && kernelInfo->kernelDescriptor.external.debugData.get()) {
         createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
@@ -176,8 +181,8 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 
             memcpy_s(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size, kernelInfo->kernelDescriptor.external.debugData->vIsa, kernelInfo->kernelDescriptor.external.debugData->vIsaSize);
 
-            NEO::Linker::SegmentInfo textSegment = {getIsaGraphicsAllocation()->getGpuAddress(),
-                                                    getIsaGraphicsAllocation()->getUnderlyingBufferSize()};
+            NEO::Linker::SegmentInfo textSegment = {static_cast<uintptr_t>(getIsaGraphicsAllocation()->getGpuAddress() + getIsaOffsetInParentAllocation()),
+                                                    getIsaSize()};
 
             NEO::Linker::applyDebugDataRelocations(decodedElf, ArrayRef<uint8_t>(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size),
                                                    textSegment, globalData, constData);
@@ -188,12 +193,15 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
     if (baseAddress) {
         auto gmmHelper = module->getDevice()->getNEODevice()->getGmmHelper();
-        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress());
+        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress() + this->kernelImmData->getIsaOffsetInParentAllocation());
     }
     return ZE_RESULT_SUCCESS;
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (isaGraphicsAllocation == nullptr) {
+        return static_cast<uint32_t>(isaSubAllocationSize);
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -781,7 +789,7 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *isaAllocation),
                                                               *neoDevice,
                                                               isaAllocation,
-                                                              0,
+                                                              static_cast<size_t>(this->kernelImmData->getIsaOffsetInParentAllocation()),
                                                               this->kernelImmData->getKernelInfo()->heapInfo.pKernelHeap,
                                                               static_cast<size_t>(this->kernelImmData->getKernelInfo()->heapInfo.KernelHeapSize));
     }
@@ -1034,6 +1042,10 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return getImmutableData()->getIsaOffsetInParentAllocation();
+}
+
 ze_result_t KernelImp::setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) {
     auto &threadArbitrationPolicy = const_cast<NEO::ThreadArbitrationPolicy &>(getKernelDescriptor().kernelAttributes.threadArbitrationPolicy);
     if (pHint->flags == ZE_SCHEDULING_HINT_EXP_FLAG_OLDEST_FIRST) {
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
@@ -20,22 +21,26 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     UNRECOVERABLE_IF(allocData == nullptr);
 
+    auto gpuAllocation = allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex());
+    auto offset = static_cast<size_t>(castToUint64(ptr) - gpuAllocation->getGpuAddress());
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
-                                                             allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->size, true);
+                                                             gpuAllocation,
+                                                             offset, size, true);
     UNRECOVERABLE_IF(ret);
 }
-void PageFaultManager::transferToGpu(void *ptr, void *device) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *allocPtr, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
 
-    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(allocPtr);
     UNRECOVERABLE_IF(allocData == nullptr);
 
+    auto gpuAllocation = allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex());
+    auto offset = static_cast<size_t>(castToUint64(ptr) - gpuAllocation->getGpuAddress());
     auto ret =
-        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(gpuAllocation,
                                                              allocData->cpuAllocation,
-                                                             allocData->size, false);
+                                                             offset, size, false);
     UNRECOVERABLE_IF(ret);
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
@@ -19,6 +19,7 @@
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/compiler_hw_info_config.h"
 #include "shared/source/helpers/constants.h"
@@ -30,16 +31,21 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
 
+#include "config.h"
 #include "program_debug_data.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
+#include <thread>
 #include <unordered_map>
 
 namespace L0 {
@@ -179,6 +185,12 @@ bool ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput inputArgs, bo
 
     inputArgs.specializedValues = this->specConstantsValues;
 
+    // debug data is not part of cached entries, so binaries built with debug info are not cached
+    auto neoDevice = device->getNEODevice();
+    inputArgs.allowCaching = clCacheEnabled &&
+                             (false == neoDevice->getDeviceInfo().debuggerActive) && (nullptr == neoDevice->getDebugger()) &&
+                             (false == NEO::CompilerOptions::contains(this->options, NEO::CompilerOptions::generateDebugInfo));
+
     NEO::TranslationOutput compilerOuput = {};
     NEO::TranslationOutput::ErrorCode compilerErr;
 
@@ -199,6 +211,8 @@ bool ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput inputArgs, bo
     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
     this->unpackedDeviceBinary = std::move(compilerOuput.deviceBinary.mem);
     this->unpackedDeviceBinarySize = compilerOuput.deviceBinary.size;
+    this->zeInfoBlob = std::move(compilerOuput.zeInfoBlob.mem);
+    this->zeInfoBlobSize = compilerOuput.zeInfoBlob.size;
     this->debugData = std::move(compilerOuput.debugData.mem);
     this->debugDataSize = compilerOuput.debugData.size;
 
@@ -315,6 +329,7 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::targetDeviceFromHwInfo(device->getHwInfo());
+    binary.zeInfoBlob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->zeInfoBlob.get()), this->zeInfoBlobSize);
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -439,6 +454,9 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 
 ModuleImp::~ModuleImp() {
     kernelImmDatas.clear();
+    if (packedIsaAllocation != nullptr) {
+        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(packedIsaAllocation);
+    }
 }
 
 NEO::Debug::Segments ModuleImp::getZebinSegments() {
@@ -447,7 +465,15 @@ NEO::Debug::Segments ModuleImp::getZebinSegments() {
         kernels.push_back({kernelImmData->getDescriptor().kernelMetadata.kernelName, kernelImmData->getIsaGraphicsAllocation()});
     ArrayRef<const uint8_t> strings = {reinterpret_cast<const uint8_t *>(translationUnit->programInfo.globalStrings.initData),
                                        translationUnit->programInfo.globalStrings.size};
-    return NEO::Debug::Segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
+    NEO::Debug::Segments segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
+    if (packedIsaAllocation != nullptr) {
+        for (const auto &kernelImmData : kernelImmDatas) {
+            auto &kernelSegment = segments.nameToSegMap[kernelImmData->getDescriptor().kernelMetadata.kernelName];
+            kernelSegment.address += static_cast<uintptr_t>(kernelImmData->getIsaOffsetInParentAllocation());
+            kernelSegment.size = kernelImmData->getIsaSize();
+        }
+    }
+    return segments;
 }
 
 bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
@@ -557,15 +583,25 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         return false;
     }
 
-    kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
-    for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
+    const auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    kernelImmDatas.reserve(kernelInfos.size());
+    auto isaOffsets = allocatePackedKernelsIsa();
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                  this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
-                                  this->type == ModuleType::Builtin);
+        if (packedIsaAllocation != nullptr) {
+            auto isaEnd = (i + 1 < isaOffsets.size()) ? isaOffsets[i + 1] : packedIsaSize;
+            kernelImmData->setIsaParentAllocation(packedIsaAllocation, isaOffsets[i], isaEnd - isaOffsets[i]);
+        }
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
 
+    const auto computeUnitsUsedForScratch = device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch;
+    NEO::parallelFor(kernelImmDatas.size(), getLoadWorkersCount(), [&](size_t kernelId) {
+        kernelImmDatas[kernelId]->initialize(kernelInfos[kernelId], device, computeUnitsUsedForScratch,
+                                             this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
+                                             this->type == ModuleType::Builtin);
+    });
+
     auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
     if (NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Zebin>(refBin)) {
         isZebinBinary = true;
@@ -594,15 +630,27 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
     const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
 
     if (this->isFullyLinked && this->type == ModuleType::User) {
-        for (auto &ki : kernelImmDatas) {
+        if (packedIsaAllocation != nullptr) {
+            if (!kernelImmDatas[0]->isIsaCopiedToAllocation()) {
+                std::vector<ArrayRef<const uint8_t>> kernelsIsa;
+                kernelsIsa.reserve(kernelImmDatas.size());
+                for (auto &ki : kernelImmDatas) {
+                    kernelsIsa.push_back({reinterpret_cast<const uint8_t *>(ki->getKernelInfo()->heapInfo.pKernelHeap),
+                                          static_cast<size_t>(ki->getKernelInfo()->heapInfo.KernelHeapSize)});
+                }
+                copyIsaToPackedAllocation(kernelsIsa);
+            }
+        } else {
+            for (auto &ki : kernelImmDatas) {
 
-            if (!ki->isIsaCopiedToAllocation()) {
+                if (!ki->isIsaCopiedToAllocation()) {
 
-                NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *ki->getIsaGraphicsAllocation()),
-                                                                      *neoDevice, ki->getIsaGraphicsAllocation(), 0, ki->getKernelInfo()->heapInfo.pKernelHeap,
-                                                                      static_cast<size_t>(ki->getKernelInfo()->heapInfo.KernelHeapSize));
+                    NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *ki->getIsaGraphicsAllocation()),
+                                                                          *neoDevice, ki->getIsaGraphicsAllocation(), 0, ki->getKernelInfo()->heapInfo.pKernelHeap,
+                                                                          static_cast<size_t>(ki->getKernelInfo()->heapInfo.KernelHeapSize));
 
-                ki->setIsaCopiedToAllocation();
+                    ki->setIsaCopiedToAllocation();
+                }
             }
         }
 
@@ -782,6 +830,21 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
 
 void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching) {
     if (this->translationUnit->programInfo.linkerInput && this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        if (packedIsaAllocation != nullptr) {
+            UNRECOVERABLE_IF(kernelImmDatas[0]->isIsaCopiedToAllocation());
+
+            packedIsaAllocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+            packedIsaAllocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+
+            std::vector<ArrayRef<const uint8_t>> kernelsIsa;
+            kernelsIsa.reserve(isaSegmentsForPatching.size());
+            for (const auto &segment : isaSegmentsForPatching) {
+                kernelsIsa.push_back({reinterpret_cast<const uint8_t *>(segment.hostPointer), segment.segmentSize});
+            }
+            copyIsaToPackedAllocation(kernelsIsa);
+            return;
+        }
+
         const auto &hwInfo = device->getNEODevice()->getHardwareInfo();
         const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
 
@@ -813,6 +876,63 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
     }
 }
 
+std::vector<size_t> ModuleImp::allocatePackedKernelsIsa() {
+    std::vector<size_t> isaOffsets;
+    const auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    auto neoDevice = static_cast<DeviceImp *>(device)->getActiveDevice();
+
+    // Debuggers track kernels by their ISA allocations, so each kernel keeps its own allocation then
+    if (NEO::DebugManager.flags.EnableModuleIsaPacking.get() == 0 || kernelInfos.size() < 2 || neoDevice->getDebugger() != nullptr) {
+        return isaOffsets;
+    }
+
+    size_t isaSize = 0u;
+    isaOffsets.reserve(kernelInfos.size());
+    for (const auto &kernelInfo : kernelInfos) {
+        isaSize = alignUp(isaSize, isaSubAllocationAlignment);
+        isaOffsets.push_back(isaSize);
+        isaSize += static_cast<size_t>(kernelInfo->heapInfo.KernelHeapSize);
+    }
+
+    const auto allocType = (this->type == ModuleType::Builtin) ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
+    packedIsaAllocation = neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {neoDevice->getRootDeviceIndex(), isaSize, allocType, neoDevice->getDeviceBitfield()});
+    if (packedIsaAllocation == nullptr) {
+        isaOffsets.clear();
+        return isaOffsets;
+    }
+    packedIsaSize = isaSize;
+    return isaOffsets;
+}
+
+uint32_t ModuleImp::getLoadWorkersCount() const {
+    if (NEO::DebugManager.flags.ModuleLoadWorkersCount.get() != -1) {
+        return static_cast<uint32_t>(std::max(NEO::DebugManager.flags.ModuleLoadWorkersCount.get(), 1));
+    }
+    // Spawning threads costs more than initializing a handful of kernels
+    if (this->translationUnit->programInfo.kernelInfos.size() < minKernelsCountForParallelLoad) {
+        return 1u;
+    }
+    return std::clamp(std::thread::hardware_concurrency(), 1u, maxDefaultLoadWorkersCount);
+}
+
+void ModuleImp::copyIsaToPackedAllocation(const std::vector<ArrayRef<const uint8_t>> &kernelsIsa) {
+    UNRECOVERABLE_IF(kernelsIsa.size() != kernelImmDatas.size());
+
+    std::vector<uint8_t> packedIsa(packedIsaSize, 0u);
+    for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+        auto isaOffset = static_cast<size_t>(kernelImmDatas[i]->getIsaOffsetInParentAllocation());
+        memcpy_s(packedIsa.data() + isaOffset, packedIsa.size() - isaOffset, kernelsIsa[i].begin(), kernelsIsa[i].size());
+        kernelImmDatas[i]->setIsaCopiedToAllocation();
+    }
+
+    auto neoDevice = device->getNEODevice();
+    const auto &hwInfo = neoDevice->getHardwareInfo();
+    const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *packedIsaAllocation),
+                                                          *neoDevice, packedIsaAllocation, 0, packedIsa.data(), packedIsa.size());
+}
+
 bool ModuleImp::linkBinary() {
     using namespace NEO;
     auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
@@ -820,7 +940,7 @@ bool ModuleImp::linkBinary() {
         isFullyLinked = true;
         return true;
     }
-    Linker linker(*linkerInput);
+    Linker linker(*linkerInput, getLoadWorkersCount());
     Linker::SegmentInfo globals;
     Linker::SegmentInfo constants;
     Linker::SegmentInfo exportedFunctions;
@@ -841,9 +961,10 @@ bool ModuleImp::linkBinary() {
     }
     if (linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = linkerInput->getExportedFunctionsSegmentId();
-        this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto &exportedFunctionsImmData = this->kernelImmDatas[exportedFunctionHeapId];
+        this->exportedFunctionsSurface = exportedFunctionsImmData->getIsaGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + exportedFunctionsImmData->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsImmData->getIsaSize();
     }
 
     Linker::KernelDescriptorsT kernelDescriptors;
@@ -855,7 +976,7 @@ bool ModuleImp::linkBinary() {
             auto &kernHeapInfo = kernelInfo->heapInfo;
             const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
             patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
@@ -915,7 +1036,7 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
-            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress());
+            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
             for (auto &data : this->getKernelImmutableDataVector()) {
                 if (data.get() != kernelImmData) {
@@ -1086,7 +1207,7 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                     auto &kernHeapInfo = kernelInfo->heapInfo;
                     const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
                     patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
+                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
                 }
             }
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
@@ -1295,8 +1416,12 @@ void ModuleImp::notifyModuleDestroy() {
 
 StackVec<NEO::GraphicsAllocation *, 32> ModuleImp::getModuleAllocations() {
     StackVec<NEO::GraphicsAllocation *, 32> allocs;
-    for (auto &kernImmData : kernelImmDatas) {
-        allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+    if (packedIsaAllocation != nullptr) {
+        allocs.push_back(packedIsaAllocation);
+    } else {
+        for (auto &kernImmData : kernelImmDatas) {
+            allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+        }
     }
 
     if (translationUnit) {
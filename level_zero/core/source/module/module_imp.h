@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/program/program_info.h"
 
 #include "level_zero/core/source/module/module.h"
@@ -66,8 +67,10 @@ struct ModuleTranslationUnit {
     std::unique_ptr<char[]> irBinary;
     size_t irBinarySize = 0U;
 
-    std::unique_ptr<char[]> unpackedDeviceBinary;
+    std::shared_ptr<const char[]> unpackedDeviceBinary; // can be owned by compiler cache
     size_t unpackedDeviceBinarySize = 0U;
+    std::shared_ptr<const char[]> zeInfoBlob; // pre-decoded .ze_info served by compiler cache
+    size_t zeInfoBlobSize = 0U;
 
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
@@ -139,7 +142,14 @@ struct ModuleImp : public Module {
     }
 
   protected:
+    static constexpr size_t isaSubAllocationAlignment = MemoryConstants::cacheLineSize;
+    static constexpr size_t minKernelsCountForParallelLoad = 32u;
+    static constexpr uint32_t maxDefaultLoadWorkersCount = 8u;
+
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
+    std::vector<size_t> allocatePackedKernelsIsa();
+    uint32_t getLoadWorkersCount() const;
+    void copyIsaToPackedAllocation(const std::vector<ArrayRef<const uint8_t>> &kernelsIsa);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Debug::Segments getZebinSegments();
@@ -156,6 +166,8 @@ struct ModuleImp : public Module {
     std::unique_ptr<ModuleTranslationUnit> translationUnit;
     ModuleBuildLog *moduleBuildLog = nullptr;
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
+    NEO::GraphicsAllocation *packedIsaAllocation = nullptr;
+    size_t packedIsaSize = 0U;
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
     NEO::Linker::RelocatedSymbolsMap symbols;
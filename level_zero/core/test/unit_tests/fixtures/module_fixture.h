@@ -360,9 +360,7 @@ struct ModuleWithZebinFixture : public DeviceFixture {
             auto zebin = ZebinTestData::ValidEmptyProgram<>();
 
             translationUnit->unpackedDeviceBinarySize = zebin.storage.size();
-            translationUnit->unpackedDeviceBinary.reset(new char[zebin.storage.size()]);
-            memcpy_s(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize,
-                     zebin.storage.data(), zebin.storage.size());
+            translationUnit->unpackedDeviceBinary = makeCopy(zebin.storage.data(), zebin.storage.size());
         }
 
         ~MockModuleWithZebin() override {
@@ -265,6 +265,7 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(appendPageFaultCopy, ze_result_t, ZE_RESULT_SUCCESS,
                      (NEO::GraphicsAllocation * dstptr,
                       NEO::GraphicsAllocation *srcptr,
+                      size_t offset,
                       size_t size,
                       bool flushHost));
 
@@ -25,10 +25,12 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::copyPatchedSegments;
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
+    using BaseClass::getModuleAllocations;
     using BaseClass::importedSymbolAllocations;
     using BaseClass::isFullyLinked;
     using BaseClass::kernelImmDatas;
     using BaseClass::maxGroupSize;
+    using BaseClass::packedIsaAllocation;
     using BaseClass::symbols;
     using BaseClass::translationUnit;
     using BaseClass::type;
@@ -105,6 +107,7 @@ struct MockCompilerInterface : public NEO::CompilerInterface {
 
         receivedApiOptions = input.apiOptions.begin();
         inputInternalOptions = input.internalOptions.begin();
+        receivedAllowCaching = input.allowCaching;
 
         if (failBuild) {
             return NEO::TranslationOutput::ErrorCode::BuildFailure;
@@ -117,12 +120,14 @@ struct MockCompilerInterface : public NEO::CompilerInterface {
 
         receivedApiOptions = input.apiOptions.begin();
         inputInternalOptions = input.internalOptions.begin();
+        receivedAllowCaching = input.allowCaching;
 
         return NEO::TranslationOutput::ErrorCode::Success;
     }
 
     std::string receivedApiOptions;
     std::string inputInternalOptions;
+    bool receivedAllowCaching = false;
     bool failBuild = false;
 };
 template <typename T1, typename T2>
@@ -321,7 +321,7 @@ HWTEST_F(CommandListImmediateFlushTaskComputeTests, givenUseCsrImmediateSubmissi
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::Compute, returnValue));
 
-    auto result = commandList->appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    auto result = commandList->appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
@@ -345,7 +345,7 @@ HWTEST_F(CommandListImmediateFlushTaskComputeTests, givenBindlessModeAndUseCsrIm
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::Compute, returnValue));
 
-    auto result = commandList->appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    auto result = commandList->appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0u, size, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
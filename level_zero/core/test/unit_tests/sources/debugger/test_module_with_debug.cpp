@@ -632,9 +632,7 @@ HWTEST_F(ModuleWithZebinAndL0DebuggerTest, GivenZebinDebugDataWhenInitializingMo
     auto zebin = ZebinTestData::ValidEmptyProgram<>();
     moduleMock->translationUnit = std::make_unique<MockModuleTranslationUnit>(device);
     moduleMock->translationUnit->unpackedDeviceBinarySize = zebin.storage.size();
-    moduleMock->translationUnit->unpackedDeviceBinary.reset(new char[zebin.storage.size()]);
-    memcpy_s(moduleMock->translationUnit->unpackedDeviceBinary.get(), moduleMock->translationUnit->unpackedDeviceBinarySize,
-             zebin.storage.data(), zebin.storage.size());
+    moduleMock->translationUnit->unpackedDeviceBinary = makeCopy(zebin.storage.data(), zebin.storage.size());
     EXPECT_EQ(0u, getMockDebuggerL0Hw<FamilyType>()->registerElfCount);
     EXPECT_TRUE(moduleMock->initialize(&moduleDesc, neoDevice));
     EXPECT_EQ(2u, getMockDebuggerL0Hw<FamilyType>()->registerElfCount);
@@ -686,9 +684,7 @@ HWTEST_F(ModuleWithZebinAndL0DebuggerTest, GivenZebinWhenModuleIsInitializedAndD
     auto zebin = ZebinTestData::ValidEmptyProgram<>();
     moduleMock->translationUnit = std::make_unique<MockModuleTranslationUnit>(device);
     moduleMock->translationUnit->unpackedDeviceBinarySize = zebin.storage.size();
-    moduleMock->translationUnit->unpackedDeviceBinary.reset(new char[zebin.storage.size()]);
-    memcpy_s(moduleMock->translationUnit->unpackedDeviceBinary.get(), moduleMock->translationUnit->unpackedDeviceBinarySize,
-             zebin.storage.data(), zebin.storage.size());
+    moduleMock->translationUnit->unpackedDeviceBinary = makeCopy(zebin.storage.data(), zebin.storage.size());
 
     getMockDebuggerL0Hw<FamilyType>()->moduleHandleToReturn = 6;
     EXPECT_TRUE(moduleMock->initialize(&moduleDesc, neoDevice));
@@ -814,9 +810,7 @@ HWTEST_F(ModuleWithZebinAndL0DebuggerTest, GivenModuleDebugHandleZeroWhenInitial
     auto zebin = ZebinTestData::ValidEmptyProgram<>();
     moduleMock->translationUnit = std::make_unique<MockModuleTranslationUnit>(device);
     moduleMock->translationUnit->unpackedDeviceBinarySize = zebin.storage.size();
-    moduleMock->translationUnit->unpackedDeviceBinary.reset(new char[zebin.storage.size()]);
-    memcpy_s(moduleMock->translationUnit->unpackedDeviceBinary.get(), moduleMock->translationUnit->unpackedDeviceBinarySize,
-             zebin.storage.data(), zebin.storage.size());
+    moduleMock->translationUnit->unpackedDeviceBinary = makeCopy(zebin.storage.data(), zebin.storage.size());
 
     getMockDebuggerL0Hw<FamilyType>()->moduleHandleToReturn = 0u;
     EXPECT_TRUE(moduleMock->initialize(&moduleDesc, neoDevice));
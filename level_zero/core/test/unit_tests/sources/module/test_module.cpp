@@ -33,6 +33,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+#include "config.h"
+
 namespace L0 {
 namespace ult {
 
@@ -94,6 +96,44 @@ HWTEST_F(ModuleTest, givenBuiltinModuleTypeWhenCreatingModuleThenCorrectTypeIsSe
     EXPECT_EQ(ModuleType::Builtin, module.type);
 }
 
+HWTEST_F(ModuleTest, givenModuleWithMultipleKernelsWhenCreatedThenKernelsIsaIsPackedIntoSingleAllocation) {
+    auto whiteboxModule = whiteboxCast(module.get());
+    ASSERT_LT(1u, whiteboxModule->kernelImmDatas.size());
+    ASSERT_NE(nullptr, whiteboxModule->packedIsaAllocation);
+
+    uint64_t previousIsaEnd = 0u;
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_EQ(whiteboxModule->packedIsaAllocation, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+
+        auto isaOffset = kernelImmData->getIsaOffsetInParentAllocation();
+        EXPECT_TRUE(isAligned<MemoryConstants::cacheLineSize>(isaOffset));
+        EXPECT_LE(previousIsaEnd, isaOffset);
+
+        const auto &heapInfo = kernelImmData->getKernelInfo()->heapInfo;
+        EXPECT_LE(heapInfo.KernelHeapSize, kernelImmData->getIsaSize());
+        EXPECT_EQ(0, memcmp(ptrOffset(whiteboxModule->packedIsaAllocation->getUnderlyingBuffer(), static_cast<size_t>(isaOffset)), heapInfo.pKernelHeap, heapInfo.KernelHeapSize));
+        previousIsaEnd = isaOffset + heapInfo.KernelHeapSize;
+    }
+
+    auto moduleAllocations = whiteboxModule->getModuleAllocations();
+    EXPECT_EQ(1u, static_cast<size_t>(std::count(moduleAllocations.begin(), moduleAllocations.end(), whiteboxModule->packedIsaAllocation)));
+}
+
+HWTEST_F(ModuleTest, givenModuleIsaPackingDisabledWhenCreatingModuleThenEachKernelHasOwnIsaAllocation) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableModuleIsaPacking.set(0);
+    createModuleFromMockBinary();
+
+    auto whiteboxModule = whiteboxCast(module.get());
+    ASSERT_LT(1u, whiteboxModule->kernelImmDatas.size());
+    EXPECT_EQ(nullptr, whiteboxModule->packedIsaAllocation);
+    EXPECT_NE(whiteboxModule->kernelImmDatas[0]->getIsaGraphicsAllocation(), whiteboxModule->kernelImmDatas[1]->getIsaGraphicsAllocation());
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_EQ(0u, kernelImmData->getIsaOffsetInParentAllocation());
+    }
+}
+
 HWTEST_F(ModuleTest, givenUserModuleWhenCreatedThenCorrectAllocationTypeIsUsedForIsa) {
     createKernel();
     EXPECT_EQ(NEO::AllocationType::KERNEL_ISA, kernel->getIsaAllocation()->getAllocationType());
@@ -151,7 +191,7 @@ HWTEST_F(ModuleTest, givenBlitterAvailableWhenCopyingPatchedSegmentsThenIsaIsTra
 
     const auto &hwInfoConfig = *HwInfoConfig::get(hwInfo.platform.eProductFamily);
     if (hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *module->getKernelImmutableDataVector()[0]->getIsaGraphicsAllocation())) {
-        EXPECT_EQ(zebinData->numOfKernels, blitterCalled);
+        EXPECT_EQ(1u, blitterCalled);
     } else {
         EXPECT_EQ(0u, blitterCalled);
     }
@@ -2212,9 +2252,7 @@ kernels:
 
     L0::ModuleTranslationUnit moduleTu(this->device);
     moduleTu.unpackedDeviceBinarySize = zebin.size();
-    moduleTu.unpackedDeviceBinary = std::make_unique<char[]>(moduleTu.unpackedDeviceBinarySize);
-    memcpy_s(moduleTu.unpackedDeviceBinary.get(), moduleTu.unpackedDeviceBinarySize,
-             zebin.data(), zebin.size());
+    moduleTu.unpackedDeviceBinary = makeCopy(zebin.data(), zebin.size());
     auto retVal = moduleTu.processUnpackedBinary();
     EXPECT_TRUE(retVal);
     EXPECT_EQ(AllocationType::BUFFER, moduleTu.globalConstBuffer->getAllocationType());
@@ -2257,6 +2295,40 @@ HWTEST_F(ModuleTranslationUnitTest, WhenBuildOptionsAreNullThenReuseExistingOpti
     EXPECT_NE(pMockCompilerInterface->inputInternalOptions.find("cl-intel-greater-than-4GB-buffer-required"), std::string::npos);
 }
 
+HWTEST_F(ModuleTranslationUnitTest, givenNoDebuggerWhenBuildingFromSpirVThenCachingIsAllowed) {
+    auto pMockCompilerInterface = new MockCompilerInterface;
+    auto &rootDeviceEnvironment = this->neoDevice->executionEnvironment->rootDeviceEnvironments[this->neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(pMockCompilerInterface);
+
+    MockModuleTranslationUnit moduleTu(this->device);
+    auto ret = moduleTu.buildFromSpirV("", 0U, nullptr, "", nullptr);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(clCacheEnabled, pMockCompilerInterface->receivedAllowCaching);
+}
+
+HWTEST_F(ModuleTranslationUnitTest, givenDebugInfoRequestedInBuildOptionsWhenBuildingFromSpirVThenCachingIsNotAllowed) {
+    auto pMockCompilerInterface = new MockCompilerInterface;
+    auto &rootDeviceEnvironment = this->neoDevice->executionEnvironment->rootDeviceEnvironments[this->neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(pMockCompilerInterface);
+
+    MockModuleTranslationUnit moduleTu(this->device);
+    auto ret = moduleTu.buildFromSpirV("", 0U, "-g", "", nullptr);
+    EXPECT_TRUE(ret);
+    EXPECT_FALSE(pMockCompilerInterface->receivedAllowCaching);
+}
+
+HWTEST_F(ModuleTranslationUnitTest, givenDebuggerActiveWhenBuildingFromSpirVThenCachingIsNotAllowed) {
+    auto pMockCompilerInterface = new MockCompilerInterface;
+    auto &rootDeviceEnvironment = this->neoDevice->executionEnvironment->rootDeviceEnvironments[this->neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(pMockCompilerInterface);
+    const_cast<NEO::DeviceInfo &>(neoDevice->getDeviceInfo()).debuggerActive = true;
+
+    MockModuleTranslationUnit moduleTu(this->device);
+    auto ret = moduleTu.buildFromSpirV("", 0U, nullptr, "", nullptr);
+    EXPECT_TRUE(ret);
+    EXPECT_FALSE(pMockCompilerInterface->receivedAllowCaching);
+}
+
 HWTEST_F(ModuleTranslationUnitTest, givenInternalOptionsThenLSCCachePolicyIsSet) {
     auto pMockCompilerInterface = new MockCompilerInterface;
     auto &rootDeviceEnvironment = this->neoDevice->executionEnvironment->rootDeviceEnvironments[this->neoDevice->getRootDeviceIndex()];
@@ -2682,6 +2754,89 @@ TEST_F(ModuleInitializeTest, whenModuleInitializeIsCalledThenCorrectResultIsRetu
     }
 }
 
+TEST_F(ModuleInitializeTest, givenModuleWithManyKernelsWhenInitializedWithMultipleWorkersThenKernelsAreInitializedAndPatchedAsWithSingleWorker) {
+    class MockModuleImp : public ModuleImp {
+      public:
+        using ModuleImp::isFullyLinked;
+        using ModuleImp::kernelImmDatas;
+        using ModuleImp::ModuleImp;
+        using ModuleImp::packedIsaAllocation;
+        using ModuleImp::packedIsaSize;
+        using ModuleImp::translationUnit;
+    };
+
+    class MyMockModuleTU : public MockModuleTU {
+      public:
+        using MockModuleTU::MockModuleTU;
+        bool createFromNativeBinary(const char *input, size_t inputSize) override { return true; }
+    };
+
+    constexpr uint32_t numKernels = 64u;
+    constexpr size_t kernelHeapSize = 0x40;
+    constexpr size_t perThreadPayloadOffsetRelocationOffset = 0x8;
+
+    std::vector<std::vector<uint8_t>> kernelHeaps(numKernels);
+    for (uint32_t i = 0u; i < numKernels; i++) {
+        kernelHeaps[i].resize(kernelHeapSize, static_cast<uint8_t>(i));
+    }
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    const auto &src = zebinData->storage;
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(src.data());
+    moduleDesc.inputSize = src.size();
+
+    auto createModule = [&](int32_t workersCount) {
+        DebugManagerStateRestore restorer;
+        DebugManager.flags.ModuleLoadWorkersCount.set(workersCount);
+
+        auto module = std::make_unique<MockModuleImp>(device, nullptr, ModuleType::User);
+        module->translationUnit = std::make_unique<MyMockModuleTU>(device);
+
+        auto linkerInput = std::make_unique<WhiteBox<NEO::LinkerInput>>();
+        linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+        linkerInput->textRelocations.resize(numKernels);
+        for (uint32_t i = 0u; i < numKernels; i++) {
+            auto kernelInfo = std::make_unique<KernelInfo>();
+            kernelInfo->kernelDescriptor.kernelMetadata.kernelName = "kernel" + std::to_string(i);
+            kernelInfo->kernelDescriptor.kernelAttributes.crossThreadDataSize = 0x40 + i * 0x8;
+            kernelInfo->heapInfo.pKernelHeap = kernelHeaps[i].data();
+            kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(kernelHeaps[i].size());
+            module->translationUnit->programInfo.kernelInfos.push_back(kernelInfo.release());
+
+            NEO::LinkerInput::RelocationInfo relocation;
+            relocation.offset = perThreadPayloadOffsetRelocationOffset;
+            relocation.type = NEO::LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset;
+            relocation.relocationSegment = NEO::SegmentType::Instructions;
+            linkerInput->textRelocations[i].push_back(relocation);
+        }
+        module->translationUnit->programInfo.linkerInput = std::move(linkerInput);
+
+        EXPECT_TRUE(module->initialize(&moduleDesc, device->getNEODevice()));
+        return module;
+    };
+
+    auto serialModule = createModule(1);
+    auto parallelModule = createModule(4);
+
+    EXPECT_TRUE(parallelModule->isFullyLinked);
+    ASSERT_EQ(numKernels, parallelModule->kernelImmDatas.size());
+    ASSERT_NE(nullptr, parallelModule->packedIsaAllocation);
+    for (uint32_t i = 0u; i < numKernels; i++) {
+        auto &kernelImmData = parallelModule->kernelImmDatas[i];
+        EXPECT_EQ(parallelModule->translationUnit->programInfo.kernelInfos[i], kernelImmData->getKernelInfo());
+        EXPECT_EQ(parallelModule->packedIsaAllocation, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_EQ(serialModule->kernelImmDatas[i]->getIsaOffsetInParentAllocation(), kernelImmData->getIsaOffsetInParentAllocation());
+        EXPECT_NE(nullptr, kernelImmData->getCrossThreadDataTemplate());
+
+        auto isa = ptrOffset(parallelModule->packedIsaAllocation->getUnderlyingBuffer(), static_cast<size_t>(kernelImmData->getIsaOffsetInParentAllocation()));
+        EXPECT_EQ(kernelImmData->getDescriptor().kernelAttributes.crossThreadDataSize, *reinterpret_cast<uint32_t *>(ptrOffset(isa, perThreadPayloadOffsetRelocationOffset)));
+    }
+    ASSERT_EQ(serialModule->packedIsaSize, parallelModule->packedIsaSize);
+    EXPECT_EQ(0, memcmp(serialModule->packedIsaAllocation->getUnderlyingBuffer(), parallelModule->packedIsaAllocation->getUnderlyingBuffer(), parallelModule->packedIsaSize));
+}
+
 using ModuleDebugDataTest = Test<DeviceFixture>;
 TEST_F(ModuleDebugDataTest, GivenDebugDataWithRelocationsWhenCreatingRelocatedDebugDataThenRelocationsAreApplied) {
     auto cip = new NEO::MockCompilerInterfaceCaptureBuildOptions();
@@ -3082,10 +3237,10 @@ TEST_F(ModuleIsaCopyTest, whenModuleIsInitializedThenIsaIsCopied) {
     auto additionalSections = {ZebinTestData::appendElfAdditionalSection::GLOBAL};
     createModuleFromMockBinary(perHwThreadPrivateMemorySizeRequested, isInternal, mockKernelImmData.get(), additionalSections);
 
-    uint32_t numOfKernels = static_cast<uint32_t>(module->getKernelImmutableDataVector().size());
+    const uint32_t numOfPackedIsaAllocations = 1;
     const uint32_t numOfGlobalBuffers = 1;
 
-    EXPECT_EQ(previouscopyMemoryToAllocationCalledTimes + numOfGlobalBuffers + numOfKernels, mockMemoryManager->copyMemoryToAllocationCalledTimes);
+    EXPECT_EQ(previouscopyMemoryToAllocationCalledTimes + numOfGlobalBuffers + numOfPackedIsaAllocations, mockMemoryManager->copyMemoryToAllocationCalledTimes);
 
     for (auto &kid : module->getKernelImmutableDataVector()) {
         EXPECT_TRUE(kid->isIsaCopiedToAllocation());
@@ -651,7 +651,7 @@ HWTEST2_F(CommandListAppendLaunchKernelXeHpcCore,
     result = commandList->initialize(device, NEO::EngineGroupType::Compute, 0u);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
-    result = commandList->appendPageFaultCopy(dstAllocation, srcAllocation, size, false);
+    result = commandList->appendPageFaultCopy(dstAllocation, srcAllocation, 0u, size, false);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_TRUE(commandList->usedKernelLaunchParams.isBuiltInKernel);
     EXPECT_TRUE(commandList->usedKernelLaunchParams.isKernelSplitOperation);
@@ -1001,6 +1001,57 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrW
     EXPECT_EQ(0, memcmp(lockedPtr, nonUsmHostPtr, 1024));
 }
 
+template <typename GfxFamily>
+class AubModeUltCommandStreamReceiver : public NEO::UltCommandStreamReceiver<GfxFamily> {
+  public:
+    using NEO::UltCommandStreamReceiver<GfxFamily>::UltCommandStreamReceiver;
+
+    NEO::CommandStreamReceiverType getType() override {
+        return NEO::CommandStreamReceiverType::CSR_AUB;
+    }
+};
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndAubCsrWhenCpuMemcpyH2DThenWrittenRangeIsMarkedAubAndTbxWritable, IsXeHpcCore) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    AubModeUltCommandStreamReceiver<FamilyType> aubCsr(*device->getNEODevice()->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getNEODevice()->getDeviceBitfield());
+    cmdList.csr = &aubCsr;
+
+    NEO::SvmAllocationData *allocData;
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, 1024, &allocData);
+    auto dstAlloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    dstAlloc->setAubWritable(false, NEO::GraphicsAllocation::allBanks);
+    dstAlloc->setTbxWritable(false, NEO::GraphicsAllocation::allBanks);
+
+    auto dstPtr = ptrOffset(devicePtr, NEO::MemoryConstants::pageSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(dstPtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr));
+
+    auto aubRanges = dstAlloc->getAubWritableRanges(NEO::GraphicsAllocation::allBanks);
+    ASSERT_NE(nullptr, aubRanges);
+    ASSERT_EQ(1u, aubRanges->size());
+    EXPECT_EQ(NEO::MemoryConstants::pageSize, (*aubRanges)[0].first);
+    EXPECT_NE(nullptr, dstAlloc->getTbxWritableRanges(NEO::GraphicsAllocation::allBanks));
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndHwCsrWhenCpuMemcpyH2DThenWritableStateIsNotChanged, IsXeHpcCore) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+    ASSERT_EQ(NEO::CommandStreamReceiverType::CSR_HW, cmdList.csr->getType());
+
+    NEO::SvmAllocationData *allocData;
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, 1024, &allocData);
+    auto dstAlloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    dstAlloc->setAubWritable(false, NEO::GraphicsAllocation::allBanks);
+    dstAlloc->setTbxWritable(false, NEO::GraphicsAllocation::allBanks);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr));
+
+    EXPECT_EQ(nullptr, dstAlloc->getAubWritableRanges(NEO::GraphicsAllocation::allBanks));
+    EXPECT_EQ(nullptr, dstAlloc->getTbxWritableRanges(NEO::GraphicsAllocation::allBanks));
+    EXPECT_FALSE(dstAlloc->isAubWritable(NEO::GraphicsAllocation::allBanks));
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndSignalEventAndNonUsmHostPtrWhenCopyH2DThenSignalEvent, IsXeHpcCore) {
     MockCommandListImmediateHw<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -758,6 +759,7 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
 
     auto result = commandList0->appendPageFaultCopy(testL0Device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(dstPtr)->gpuAllocations.getDefaultGraphicsAllocation(),
                                                     testL0Device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(srcPtr)->gpuAllocations.getDefaultGraphicsAllocation(),
+                                                    0u,
                                                     size,
                                                     false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
@@ -770,5 +772,143 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndChunkSizeWhenAppendingMemoryCopyThenEachEngineGetsMultipleChunks, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsChunkSize.set(MemoryConstants::megaByte);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(),
+                            &deviceDesc,
+                            size, alignment, &srcPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    for (auto cmdQ : bcsSplit.cmdQs) {
+        EXPECT_EQ(static_cast<CommandQueueImp *>(cmdQ)->getTaskCount(), 2u);
+    }
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndEngineWithPendingTasksWhenAppendingMemoryCopyThenChunksAreAssignedToLeastLoadedEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsChunkSize.set(MemoryConstants::megaByte);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    auto busyCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getCsr());
+    auto initialTaskCount = busyCsr->taskCount;
+    busyCsr->taskCount = *busyCsr->getTagAddress() + 2;
+
+    auto enginesLoad = bcsSplit.getEnginesLoad();
+    ASSERT_EQ(4u, enginesLoad.size());
+    EXPECT_EQ(2 * BcsSplit::defaultMaxChunkSize, enginesLoad[0]);
+    EXPECT_EQ(0u, enginesLoad[1]);
+    EXPECT_EQ(0u, enginesLoad[2]);
+    EXPECT_EQ(0u, enginesLoad[3]);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(),
+                            &deviceDesc,
+                            size, alignment, &srcPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 3u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 3u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 2u);
+
+    busyCsr->taskCount = initialTaskCount;
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+TEST(BcsSplitTests, givenCopySizeWhenGettingChunkSizeThenItIsLimitedByEvenSplitAndMaxChunkSize) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(2 * MemoryConstants::megaByte, BcsSplit::getChunkSize(8 * MemoryConstants::megaByte, 4u));
+    EXPECT_EQ(BcsSplit::defaultMaxChunkSize, BcsSplit::getChunkSize(64 * BcsSplit::defaultMaxChunkSize, 4u));
+
+    DebugManager.flags.SplitBcsChunkSize.set(MemoryConstants::megaByte);
+    EXPECT_EQ(MemoryConstants::megaByte, BcsSplit::getChunkSize(8 * MemoryConstants::megaByte, 4u));
+}
+
+TEST(BcsSplitTests, givenEqualEnginesLoadWhenSchedulingChunksThenChunksAreAssignedRoundRobinAndCoverWholeCopy) {
+    auto chunks = BcsSplit::scheduleChunks(10u, 3u, {0u, 0u, 0u});
+    ASSERT_EQ(4u, chunks.size());
+
+    const std::array<std::tuple<size_t, size_t, size_t>, 4> expectedChunks = {{{0u, 0u, 3u}, {1u, 3u, 3u}, {2u, 6u, 3u}, {0u, 9u, 1u}}};
+    for (size_t i = 0; i < chunks.size(); i++) {
+        auto &[engineIndex, offset, size] = expectedChunks[i];
+        EXPECT_EQ(engineIndex, chunks[i].engineIndex);
+        EXPECT_EQ(offset, chunks[i].offset);
+        EXPECT_EQ(size, chunks[i].size);
+    }
+}
+
+TEST(BcsSplitTests, givenDifferentEnginesLoadWhenSchedulingChunksThenEachChunkIsAssignedToLeastLoadedEngine) {
+    auto chunks = BcsSplit::scheduleChunks(8u, 2u, {5u, 0u, 1u});
+    ASSERT_EQ(4u, chunks.size());
+    EXPECT_EQ(1u, chunks[0].engineIndex);
+    EXPECT_EQ(2u, chunks[1].engineIndex);
+    EXPECT_EQ(1u, chunks[2].engineIndex);
+    EXPECT_EQ(2u, chunks[3].engineIndex);
+
+    EXPECT_TRUE(BcsSplit::scheduleChunks(8u, 2u, {}).empty());
+}
+
 } // namespace ult
 } // namespace L0
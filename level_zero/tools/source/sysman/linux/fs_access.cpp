@@ -10,11 +10,14 @@
 #include <climits>
 
 #include <array>
+#include <cctype>
 #include <cerrno>
+#include <chrono>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace L0 {
@@ -374,6 +377,87 @@ void ProcfsAccess::kill(const ::pid_t pid) {
     return ::getpid();
 }
 
+// Sampler of numeric files
+FsSampler::FsSampler(const std::string baseDir) : baseDir(baseDir) {
+}
+
+FsSampler::~FsSampler() {
+    closeFiles();
+}
+
+uint32_t FsSampler::addFile(const std::string file) {
+    // Files are opened lazily on first read
+    files.push_back({baseDir + file, -1});
+    return static_cast<uint32_t>(files.size() - 1);
+}
+
+void FsSampler::closeFiles() {
+    for (auto &file : files) {
+        if (file.fd >= 0) {
+            closeFunction(file.fd);
+            file.fd = -1;
+        }
+    }
+}
+
+ze_result_t FsSampler::read(const uint32_t fileId, uint64_t &val) {
+    if (fileId >= files.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto &file = files[fileId];
+    if (file.fd < 0) {
+        file.fd = openFunction(file.path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file.fd < 0) {
+            return getResult(errno);
+        }
+    }
+
+    std::array<char, maxValueLength + 1> buffer = {};
+    ssize_t bytesRead = preadFunction(file.fd, buffer.data(), maxValueLength, 0);
+    if (bytesRead <= 0) {
+        ze_result_t result = (bytesRead < 0) ? getResult(errno) : ZE_RESULT_ERROR_UNKNOWN;
+        // Reopen on next read, the file might have been recreated meanwhile
+        closeFunction(file.fd);
+        file.fd = -1;
+        return result;
+    }
+    buffer[bytesRead] = '\0';
+
+    // strtoull silently wraps negative numbers, reject them upfront
+    const char *begin = buffer.data();
+    while (std::isspace(static_cast<unsigned char>(*begin))) {
+        begin++;
+    }
+    if (*begin == '-') {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    char *end = nullptr;
+    errno = 0;
+    uint64_t value = std::strtoull(begin, &end, 10);
+    if ((end == begin) || (ERANGE == errno)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    val = value;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t FsSampler::sample(Snapshot &snapshot) {
+    // All values of a snapshot share single timestamp, taken before the files are read
+    snapshot.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    snapshot.results.resize(files.size());
+    snapshot.values.resize(files.size());
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    for (uint32_t fileId = 0u; fileId < files.size(); fileId++) {
+        snapshot.results[fileId] = read(fileId, snapshot.values[fileId]);
+        if ((ZE_RESULT_SUCCESS != snapshot.results[fileId]) && (ZE_RESULT_SUCCESS == result)) {
+            result = snapshot.results[fileId];
+        }
+    }
+    return result;
+}
+
 // Sysfs Access
 const std::string SysfsAccess::drmPath = "/sys/class/drm/";
 const std::string SysfsAccess::devicesPath = "device/drm/";
@@ -585,4 +669,9 @@ bool SysfsAccess::isRootUser() {
     return FsAccess::isRootUser();
 }
 
+std::unique_ptr<FsSampler> SysfsAccess::createSampler() {
+    // Files added to the sampler are relative to sysfs directory of this device
+    return std::make_unique<FsSampler>(dirname);
+}
+
 } // namespace L0
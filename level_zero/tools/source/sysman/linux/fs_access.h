@@ -15,6 +15,7 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -81,6 +82,47 @@ class ProcfsAccess : private FsAccess {
     static const std::string fdDir;
 };
 
+// Samples a fixed set of numeric files. Files are opened once and re-read
+// with pread, so polling them does not pay for open/close on every read.
+class FsSampler {
+  public:
+    struct Snapshot {
+        uint64_t timestampNs = 0u;
+        std::vector<ze_result_t> results;
+        std::vector<uint64_t> values;
+    };
+
+    FsSampler() = default;
+    FsSampler(const std::string baseDir);
+    virtual ~FsSampler();
+
+    FsSampler(const FsSampler &) = delete;
+    FsSampler &operator=(const FsSampler &) = delete;
+
+    // Returns id of the file used to index snapshot entries
+    uint32_t addFile(const std::string file);
+    size_t getFilesCount() const { return files.size(); }
+
+    MOCKABLE_VIRTUAL ze_result_t read(const uint32_t fileId, uint64_t &val);
+    MOCKABLE_VIRTUAL ze_result_t sample(Snapshot &snapshot);
+    void closeFiles();
+
+  protected:
+    struct SampledFile {
+        std::string path;
+        int fd = -1;
+    };
+
+    static constexpr size_t maxValueLength = 32u;
+
+    std::string baseDir;
+    std::vector<SampledFile> files;
+
+    decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
+    decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
+    decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+};
+
 class SysfsAccess : protected FsAccess {
   public:
     static SysfsAccess *create(const std::string file);
@@ -113,6 +155,7 @@ class SysfsAccess : protected FsAccess {
     MOCKABLE_VIRTUAL bool isMyDeviceFile(const std::string dev);
     bool directoryExists(const std::string path) override;
     bool isRootUser() override;
+    MOCKABLE_VIRTUAL std::unique_ptr<FsSampler> createSampler();
 
   private:
     SysfsAccess(const std::string file);
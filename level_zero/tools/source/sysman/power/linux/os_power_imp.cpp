@@ -73,7 +73,10 @@ ze_result_t LinuxPowerImp::getPmtEnergyCounter(zes_power_energy_counter_t *pEner
 }
 ze_result_t LinuxPowerImp::getEnergyCounter(zes_power_energy_counter_t *pEnergy) {
     powerGetTimestamp(pEnergy->timestamp);
-    ze_result_t result = pSysfsAccess->read(i915HwmonDir + "/" + energyCounterNode, pEnergy->energy);
+    ze_result_t result = ZE_RESULT_ERROR_NOT_AVAILABLE;
+    if (pEnergySampler != nullptr) {
+        result = pEnergySampler->read(energyCounterId, pEnergy->energy);
+    }
     if (result != ZE_RESULT_SUCCESS) {
         if (pPmt != nullptr) {
             return getPmtEnergyCounter(pEnergy);
@@ -225,6 +228,11 @@ bool LinuxPowerImp::isPowerModuleSupported() {
             canControl = true;
         }
     }
+    if (hwmonDirExists) {
+        // Energy counter is polled frequently, keep its file open between reads
+        pEnergySampler = pSysfsAccess->createSampler();
+        energyCounterId = pEnergySampler->addFile(i915HwmonDir + "/" + energyCounterNode);
+    }
     if (hwmonDirExists == false) {
         return (pPmt != nullptr);
     }
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
+#include "level_zero/tools/source/sysman/linux/fs_access.h"
 #include "level_zero/tools/source/sysman/power/os_power.h"
 
 #include <memory>
@@ -15,7 +16,6 @@
 
 namespace L0 {
 
-class SysfsAccess;
 class PlatformMonitoringTech;
 class LinuxPowerImp : public OsPower, NEO::NonCopyableOrMovableClass {
   public:
@@ -42,6 +42,8 @@ class LinuxPowerImp : public OsPower, NEO::NonCopyableOrMovableClass {
 
   private:
     std::string i915HwmonDir;
+    std::unique_ptr<FsSampler> pEnergySampler;
+    uint32_t energyCounterId = 0;
     std::string energyHwmonDir;
     static const std::string hwmonDir;
     static const std::string i915;
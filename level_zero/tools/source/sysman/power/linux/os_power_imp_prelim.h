@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
+#include "level_zero/tools/source/sysman/linux/fs_access.h"
 #include "level_zero/tools/source/sysman/power/os_power.h"
 
 #include "igfxfmid.h"
@@ -17,7 +18,6 @@
 
 namespace L0 {
 
-class SysfsAccess;
 class PlatformMonitoringTech;
 class LinuxPowerImp : public OsPower, NEO::NonCopyableOrMovableClass {
   public:
@@ -44,6 +44,8 @@ class LinuxPowerImp : public OsPower, NEO::NonCopyableOrMovableClass {
 
   private:
     std::string i915HwmonDir;
+    std::unique_ptr<FsSampler> pEnergySampler;
+    uint32_t energyCounterId = 0;
     std::string criticalPowerLimit;
     static const std::string hwmonDir;
     static const std::string i915;
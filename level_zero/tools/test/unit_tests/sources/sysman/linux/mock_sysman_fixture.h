@@ -166,5 +166,30 @@ class PublicSysfsAccess : public L0::SysfsAccess {
     using SysfsAccess::accessSyscall;
 };
 
+class PublicFsSampler : public L0::FsSampler {
+  public:
+    using FsSampler::closeFunction;
+    using FsSampler::files;
+    using FsSampler::FsSampler;
+    using FsSampler::openFunction;
+    using FsSampler::preadFunction;
+};
+
+// Serves sampled files through read() of the given SysfsAccess, so mocks of
+// sysfs reads also apply to values read by the sampler
+class MockFsSamplerForwarder : public L0::FsSampler {
+  public:
+    MockFsSamplerForwarder(L0::SysfsAccess *pSysfsAccess) : pSysfsAccess(pSysfsAccess) {}
+
+    ze_result_t read(const uint32_t fileId, uint64_t &val) override {
+        if (fileId >= files.size()) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return pSysfsAccess->read(files[fileId].path, val);
+    }
+
+    L0::SysfsAccess *pSysfsAccess = nullptr;
+};
+
 } // namespace ult
 } // namespace L0
@@ -13,6 +13,8 @@
 #include "level_zero/tools/source/sysman/ras/ras_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
+#include <fcntl.h>
+
 namespace L0 {
 namespace ult {
 
@@ -258,6 +260,111 @@ TEST_F(SysmanDeviceFixture, GivenInvalidPathnameWhenCallingFsAccessExistsThenErr
     EXPECT_FALSE(fsAccess.fileExists(path));
 }
 
+class FsSamplerTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/fs_sampler_XXXXXX";
+        ASSERT_NE(nullptr, ::mkdtemp(dirTemplate));
+        fakeSysfsDir = std::string(dirTemplate) + "/";
+        openCalled = 0u;
+        closeCalled = 0u;
+    }
+
+    void TearDown() override {
+        for (auto &file : createdFiles) {
+            ::unlink(file.c_str());
+        }
+        ::rmdir(fakeSysfsDir.c_str());
+    }
+
+    void writeFile(const std::string &name, const std::string &content) {
+        std::ofstream fs(fakeSysfsDir + name, std::ios::trunc);
+        fs << content;
+        createdFiles.push_back(fakeSysfsDir + name);
+    }
+
+    std::unique_ptr<PublicFsSampler> createSampler() {
+        auto sampler = std::make_unique<PublicFsSampler>(fakeSysfsDir);
+        sampler->openFunction = [](const char *file, int flags) -> int {
+            openCalled++;
+            return ::open(file, flags);
+        };
+        sampler->closeFunction = [](int fd) -> int {
+            closeCalled++;
+            return ::close(fd);
+        };
+        sampler->preadFunction = [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+            return ::pread(fd, buf, count, offset);
+        };
+        return sampler;
+    }
+
+    static uint32_t openCalled;
+    static uint32_t closeCalled;
+    std::string fakeSysfsDir;
+    std::vector<std::string> createdFiles;
+};
+
+uint32_t FsSamplerTest::openCalled = 0u;
+uint32_t FsSamplerTest::closeCalled = 0u;
+
+TEST_F(FsSamplerTest, GivenFakeSysfsTreeWhenSamplingFilesThenValuesAreReadAndFilesAreOpenedOnlyOnce) {
+    writeFile("cur_freq", "300\n");
+    writeFile("energy", "123456789012\n");
+    auto sampler = createSampler();
+    auto freqId = sampler->addFile("cur_freq");
+    auto energyId = sampler->addFile("energy");
+    EXPECT_EQ(2u, sampler->getFilesCount());
+
+    FsSampler::Snapshot firstSnapshot;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sampler->sample(firstSnapshot));
+    ASSERT_EQ(2u, firstSnapshot.values.size());
+    EXPECT_EQ(300u, firstSnapshot.values[freqId]);
+    EXPECT_EQ(123456789012u, firstSnapshot.values[energyId]);
+    EXPECT_EQ(2u, openCalled);
+
+    writeFile("cur_freq", "1100\n");
+    FsSampler::Snapshot secondSnapshot;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sampler->sample(secondSnapshot));
+    EXPECT_EQ(1100u, secondSnapshot.values[freqId]);
+    EXPECT_EQ(123456789012u, secondSnapshot.values[energyId]);
+    EXPECT_LE(firstSnapshot.timestampNs, secondSnapshot.timestampNs);
+    EXPECT_EQ(2u, openCalled);
+
+    sampler.reset();
+    EXPECT_EQ(2u, closeCalled);
+}
+
+TEST_F(FsSamplerTest, GivenMissingOrMalformedFilesWhenSamplingThenErrorsAreReportedPerFileAndOtherValuesAreRead) {
+    writeFile("cur_freq", "300\n");
+    writeFile("malformed", "abc\n");
+    writeFile("negative", " -5\n");
+    writeFile("empty", "");
+    auto sampler = createSampler();
+    auto freqId = sampler->addFile("cur_freq");
+    auto missingId = sampler->addFile("missing");
+    auto malformedId = sampler->addFile("malformed");
+    auto negativeId = sampler->addFile("negative");
+    auto emptyId = sampler->addFile("empty");
+
+    FsSampler::Snapshot snapshot;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, sampler->sample(snapshot));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, snapshot.results[freqId]);
+    EXPECT_EQ(300u, snapshot.values[freqId]);
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, snapshot.results[missingId]);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, snapshot.results[malformedId]);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, snapshot.results[negativeId]);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, snapshot.results[emptyId]);
+    EXPECT_EQ(-1, sampler->files[missingId].fd);
+    EXPECT_EQ(-1, sampler->files[emptyId].fd);
+
+    writeFile("missing", "42\n");
+    uint64_t value = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sampler->read(missingId, value));
+    EXPECT_EQ(42u, value);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, sampler->read(static_cast<uint32_t>(sampler->getFilesCount()), value));
+}
+
 TEST_F(SysmanDeviceFixture, GivenCreateSysfsAccessHandleWhenCallinggetSysfsAccessThenCreatedSysfsAccessHandleHandleWillBeRetrieved) {
     if (pLinuxSysmanImp->pSysfsAccess != nullptr) {
         //delete previously allocated pSysfsAccess
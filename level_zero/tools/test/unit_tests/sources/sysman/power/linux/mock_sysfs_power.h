@@ -247,6 +247,10 @@ struct Mock<PowerSysfsAccess> : public PowerSysfsAccess {
 
     Mock<PowerSysfsAccess>() = default;
 
+    std::unique_ptr<FsSampler> createSampler() override {
+        return std::make_unique<MockFsSamplerForwarder>(this);
+    }
+
     MOCK_METHOD(ze_result_t, read, (const std::string file, uint64_t &val), (override));
     MOCK_METHOD(ze_result_t, read, (const std::string file, std::string &val), (override));
     MOCK_METHOD(ze_result_t, read, (const std::string file, uint32_t &val), (override));
@@ -219,6 +219,10 @@ struct Mock<PowerSysfsAccess> : public PowerSysfsAccess {
     }
 
     Mock<PowerSysfsAccess>() = default;
+
+    std::unique_ptr<FsSampler> createSampler() override {
+        return std::make_unique<MockFsSamplerForwarder>(this);
+    }
 };
 
 class PowerPmt : public PlatformMonitoringTech {
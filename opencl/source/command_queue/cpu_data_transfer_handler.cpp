@@ -159,8 +159,20 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
         }
         if (modifySimulationFlags) {
             auto graphicsAllocation = transferProperties.memObj->getGraphicsAllocation(getDevice().getRootDeviceIndex());
-            graphicsAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
-            graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+            auto allocationPtr = transferProperties.lockedPtr ? transferProperties.lockedPtr : graphicsAllocation->getUnderlyingBuffer();
+            auto writtenPtr = transferProperties.getCpuPtrForReadWrite();
+            auto writtenSize = transferProperties.size[0];
+            bool writtenRangeKnown = (transferProperties.cmdType == CL_COMMAND_WRITE_BUFFER) && (allocationPtr != nullptr) &&
+                                     (writtenPtr >= allocationPtr) &&
+                                     (ptrOffset(writtenPtr, writtenSize) <= ptrOffset(allocationPtr, graphicsAllocation->getUnderlyingBufferSize()));
+            if (writtenRangeKnown) {
+                auto writtenOffset = ptrDiff(writtenPtr, allocationPtr);
+                graphicsAllocation->setAubWritableRange(writtenOffset, writtenSize, GraphicsAllocation::defaultBank);
+                graphicsAllocation->setTbxWritableRange(writtenOffset, writtenSize, GraphicsAllocation::defaultBank);
+            } else {
+                graphicsAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
+                graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+            }
         }
     }
 
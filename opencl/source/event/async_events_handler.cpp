@@ -7,12 +7,14 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
@@ -21,8 +23,15 @@ AsyncEventsHandler::AsyncEventsHandler() {
     registerList.reserve(64);
     list.reserve(64);
     pendingList.reserve(64);
+    readyList.reserve(64);
 }
 
+namespace {
+bool compareTaskCounts(const std::pair<uint32_t, Event *> &lhs, const std::pair<uint32_t, Event *> &rhs) {
+    return lhs.first > rhs.first;
+}
+} // namespace
+
 AsyncEventsHandler::~AsyncEventsHandler() {
     closeThread();
 }
@@ -37,25 +46,67 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+void AsyncEventsHandler::updateEvent(Event *event) {
+    event->updateExecutionStatus();
+    if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+        auto csr = event->getCsrToCompleteOn();
+        if (csr) {
+            auto &eventsHeap = submittedEvents[csr];
+            eventsHeap.emplace_back(event->peekTaskCount(), event);
+            std::push_heap(eventsHeap.begin(), eventsHeap.end(), compareTaskCounts);
+        } else {
+            pendingList.push_back(event);
+        }
+    } else {
+        event->decRefInternal();
+    }
+}
+
 Event *AsyncEventsHandler::processList() {
-    uint32_t lowestTaskCount = CompletionStamp::notReady;
-    Event *sleepCandidate = nullptr;
     pendingList.clear();
-
-    for (auto event : list) {
-        event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
-            if (event->peekTaskCount() < lowestTaskCount) {
-                sleepCandidate = event;
-                lowestTaskCount = event->peekTaskCount();
+    readyList.clear();
+
+    // Submitted events can't complete before tag of their CSR reaches their task count,
+    // so only events from the top of each heap are updated, in task count order
+    for (auto &[csr, eventsHeap] : submittedEvents) {
+        while (!eventsHeap.empty()) {
+            auto [taskCount, event] = eventsHeap.front();
+            if ((event->peekExecutionStatus() == CL_SUBMITTED) && !csr->testTaskCountReady(csr->getTagAddress(), taskCount)) {
+                break;
             }
-        } else {
-            event->decRefInternal();
+            std::pop_heap(eventsHeap.begin(), eventsHeap.end(), compareTaskCounts);
+            eventsHeap.pop_back();
+            readyList.push_back(event);
         }
     }
 
+    for (auto event : list) {
+        updateEvent(event);
+    }
+    for (auto event : readyList) {
+        updateEvent(event);
+    }
+
     list.swap(pendingList);
+    return getSleepCandidate();
+}
+
+Event *AsyncEventsHandler::getSleepCandidate() const {
+    uint32_t lowestTaskCount = CompletionStamp::notReady;
+    Event *sleepCandidate = nullptr;
+
+    for (auto event : list) {
+        if (event->peekTaskCount() < lowestTaskCount) {
+            sleepCandidate = event;
+            lowestTaskCount = event->peekTaskCount();
+        }
+    }
+    for (auto &[csr, eventsHeap] : submittedEvents) {
+        if (!eventsHeap.empty() && (eventsHeap.front().second->peekTaskCount() < lowestTaskCount)) {
+            sleepCandidate = eventsHeap.front().second;
+            lowestTaskCount = sleepCandidate->peekTaskCount();
+        }
+    }
     return sleepCandidate;
 }
 
@@ -73,7 +124,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (self->list.empty() && self->isSubmittedEventsEmpty()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -114,11 +165,21 @@ void AsyncEventsHandler::transferRegisterList() {
     registerList.clear();
 }
 
+bool AsyncEventsHandler::isSubmittedEventsEmpty() const {
+    return std::all_of(submittedEvents.begin(), submittedEvents.end(), [](const auto &csrEvents) { return csrEvents.second.empty(); });
+}
+
 void AsyncEventsHandler::releaseEvents() {
     for (auto event : list) {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &[csr, eventsHeap] : submittedEvents) {
+        for (auto &[taskCount, event] : eventsHeap) {
+            event->decRefInternal();
+        }
+    }
+    submittedEvents.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,9 +10,12 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,7 +27,13 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    // min-heap of submitted events ordered by task count they were pushed with
+    using EventsHeap = std::vector<std::pair<uint32_t, Event *>>;
+
     Event *processList();
+    void updateEvent(Event *event);
+    Event *getSleepCandidate() const;
+    bool isSubmittedEventsEmpty() const;
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,6 +41,8 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<Event *> readyList;
+    std::unordered_map<CommandStreamReceiver *, EventsHeap> submittedEvents;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
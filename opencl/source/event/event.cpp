@@ -682,6 +682,16 @@ bool Event::isCompleted() {
     return cmdQueue->isCompleted(getCompletionStamp(), this->bcsState) || this->areTimestampsCompleted();
 }
 
+CommandStreamReceiver *Event::getCsrToCompleteOn() const {
+    if ((cmdQueue == nullptr) || (taskLevel == CompletionStamp::notReady) || (taskCount == CompletionStamp::notReady) || (executionStatus != CL_SUBMITTED)) {
+        return nullptr;
+    }
+    if ((timestampPacketContainer.get() != nullptr) && isWaitForTimestampsEnabled()) {
+        return nullptr;
+    }
+    return &cmdQueue->getGpgpuCommandStreamReceiver();
+}
+
 bool Event::isWaitForTimestampsEnabled() const {
     const auto &hwInfo = cmdQueue->getDevice().getHardwareInfo();
     const auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
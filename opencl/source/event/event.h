@@ -26,6 +26,7 @@ namespace NEO {
 template <typename TagType>
 class TagNode;
 class CommandQueue;
+class CommandStreamReceiver;
 class Context;
 class Device;
 class TimestampPacketContainer;
@@ -281,6 +282,11 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     virtual void updateExecutionStatus();
     void tryFlushEvent();
 
+    // Returns CSR whose tag has to reach this event's task count before the event can complete.
+    // Returns nullptr when completion can not be predicted from the task count
+    // (not submitted yet, user event or completion signaled by timestamps).
+    CommandStreamReceiver *getCsrToCompleteOn() const;
+
     uint32_t peekTaskCount() const {
         return this->taskCount;
     }
@@ -144,6 +144,8 @@ cl_int Program::build(
                     continue;
                 }
                 this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
+                this->buildInfos[clDevice->getRootDeviceIndex()].zeInfoBlob = std::move(compilerOuput.zeInfoBlob.mem);
+                this->buildInfos[clDevice->getRootDeviceIndex()].zeInfoBlobSize = compilerOuput.zeInfoBlob.size;
                 phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
             }
             if (retVal != CL_SUCCESS) {
@@ -156,6 +156,8 @@ cl_int Program::link(
                 }
 
                 this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, rootDeviceIndex);
+                this->buildInfos[rootDeviceIndex].zeInfoBlob = std::move(compilerOuput.zeInfoBlob.mem);
+                this->buildInfos[rootDeviceIndex].zeInfoBlobSize = compilerOuput.zeInfoBlob.size;
                 this->buildInfos[device->getRootDeviceIndex()].debugData = std::move(compilerOuput.debugData.mem);
                 this->buildInfos[device->getRootDeviceIndex()].debugDataSize = compilerOuput.debugData.size;
 
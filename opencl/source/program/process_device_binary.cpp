@@ -179,6 +179,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
     SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::targetDeviceFromHwInfo(clDevice.getDevice().getHardwareInfo());
+    binary.zeInfoBlob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.zeInfoBlob.get()), buildInfo.zeInfoBlobSize);
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -366,14 +366,16 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
     this->allowNonUniform = allowNonUniform;
 }
 
-void Program::replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
-    if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
+void Program::replaceDeviceBinary(std::shared_ptr<const char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
+    this->buildInfos[rootDeviceIndex].zeInfoBlob.reset();
+    this->buildInfos[rootDeviceIndex].zeInfoBlobSize = 0U;
+    if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(newBinary.get()), newBinarySize))) {
         this->buildInfos[rootDeviceIndex].packedDeviceBinary = std::move(newBinary);
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = newBinarySize;
         this->buildInfos[rootDeviceIndex].unpackedDeviceBinary.reset();
         this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = 0U;
-        if (isAnySingleDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(this->buildInfos[rootDeviceIndex].packedDeviceBinary.get()), this->buildInfos[rootDeviceIndex].packedDeviceBinarySize))) {
-            this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy(buildInfos[rootDeviceIndex].packedDeviceBinary.get(), buildInfos[rootDeviceIndex].packedDeviceBinarySize);
+        if (isAnySingleDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->buildInfos[rootDeviceIndex].packedDeviceBinary.get()), this->buildInfos[rootDeviceIndex].packedDeviceBinarySize))) {
+            this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = buildInfos[rootDeviceIndex].packedDeviceBinary;
             this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = buildInfos[rootDeviceIndex].packedDeviceBinarySize;
         }
     } else {
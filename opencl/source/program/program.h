@@ -254,7 +254,7 @@ class Program : public BaseObject<_cl_program> {
         buildInfos[rootDeviceIndex].linkerInput = std::move(linkerInput);
     }
 
-    MOCKABLE_VIRTUAL void replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex);
+    MOCKABLE_VIRTUAL void replaceDeviceBinary(std::shared_ptr<const char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex);
 
     static bool isValidCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
     void invokeCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
@@ -347,11 +347,15 @@ class Program : public BaseObject<_cl_program> {
         Linker::RelocatedSymbolsMap symbols{};
         std::string buildLog{};
 
-        std::unique_ptr<char[]> unpackedDeviceBinary;
+        // both may refer to the same buffer, which can be owned by compiler cache
+        std::shared_ptr<const char[]> unpackedDeviceBinary;
         size_t unpackedDeviceBinarySize = 0U;
 
-        std::unique_ptr<char[]> packedDeviceBinary;
+        std::shared_ptr<const char[]> packedDeviceBinary;
         size_t packedDeviceBinarySize = 0U;
+
+        std::shared_ptr<const char[]> zeInfoBlob; // pre-decoded .ze_info served by compiler cache along with device binary
+        size_t zeInfoBlobSize = 0U;
         ProgramInfo::GlobalSurfaceInfo constStringSectionData;
 
         std::unique_ptr<char[]> debugData;
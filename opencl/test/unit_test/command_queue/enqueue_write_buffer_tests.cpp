@@ -297,6 +297,37 @@ HWTEST_F(EnqueueWriteBufferTypeTest, givenOOQWithEnabledSupportCpuCopiesAndDstPt
     EXPECT_EQ(pCmdOOQ->taskLevel, 0u);
     pCmdOOQ->flush();
 }
+HWTEST_F(EnqueueWriteBufferTypeTest, givenCpuCopyOnWriteBufferWhenWriteBufferIsExecutedThenOnlyWrittenRangeIsMadeAubAndTbxWritable) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(1);
+    auto allocation = zeroCopyBuffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    allocation->setAubWritable(false, GraphicsAllocation::defaultBank);
+    allocation->setTbxWritable(false, GraphicsAllocation::defaultBank);
+
+    char data[MemoryConstants::cacheLineSize] = {};
+    auto retVal = pCmdQ->enqueueWriteBuffer(zeroCopyBuffer.get(),
+                                            CL_TRUE,
+                                            0,
+                                            MemoryConstants::cacheLineSize,
+                                            data,
+                                            nullptr,
+                                            0,
+                                            nullptr,
+                                            nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_TRUE(allocation->isAubWritable(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(allocation->isTbxWritable(GraphicsAllocation::defaultBank));
+    auto aubRanges = allocation->getAubWritableRanges(GraphicsAllocation::defaultBank);
+    auto tbxRanges = allocation->getTbxWritableRanges(GraphicsAllocation::defaultBank);
+    ASSERT_NE(nullptr, aubRanges);
+    ASSERT_NE(nullptr, tbxRanges);
+    ASSERT_EQ(1u, aubRanges->size());
+    EXPECT_EQ(0u, (*aubRanges)[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, (*aubRanges)[0].second);
+    EXPECT_EQ(*aubRanges, *tbxRanges);
+}
+
 HWTEST_F(EnqueueWriteBufferTypeTest, givenOOQWithDisabledSupportCpuCopiesAndDstPtrEqualSrcPtrZeroCopyBufferWhenWriteBufferIsExecutedThenTaskLevelNotIncreased) {
     DebugManagerStateRestore dbgRestore;
     DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,9 @@ TEST(CompilerCache, GivenDefaultClCacheConfigThenValuesAreProperlyPopulated) {
     EXPECT_STREQ("cl_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(NEO::CompilerCacheConfig::defaultCacheSize, cacheConfig.cacheSize);
+    EXPECT_EQ(NEO::CompilerCacheConfig::defaultMemoryTierSize, cacheConfig.memoryTierSize);
+    EXPECT_EQ(NEO::CompilerCacheConfig::defaultMmapThreshold, cacheConfig.mmapThreshold);
 }
 
 TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoaded) {
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/mock_method_macros.h"
 #include "shared/test/common/test_macros/test.h"
@@ -19,6 +20,8 @@
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 
+#include <string>
+
 using namespace NEO;
 using namespace ::testing;
 
@@ -54,6 +57,10 @@ class AsyncEventsHandlerTests : public ::testing::Test {
         ++(*(int *)data);
     }
 
+    static void CL_CALLBACK recordCompletionFcn(cl_event e, cl_int status, void *data) {
+        reinterpret_cast<std::vector<cl_event> *>(data)->push_back(e);
+    }
+
     void SetUp() override {
         dbgRestore.reset(new DebugManagerStateRestore());
         DebugManager.flags.EnableAsyncEventsHandler.set(false);
@@ -333,6 +340,122 @@ TEST_F(AsyncEventsHandlerTests, givenRegistredEventsWhenProcessIsCalledThenRetur
     event3->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWhenTagIsUpdatedThenCallbacksOfCompletedEventsAreCalledInTaskCountOrder) {
+    std::vector<cl_event> completedEvents;
+    event1->setTaskStamp(0, 3);
+    event2->setTaskStamp(0, 1);
+    event3->setTaskStamp(0, 2);
+    for (auto event : {event1.get(), event2.get(), event3.get()}) {
+        event->addCallback(&this->recordCompletionFcn, CL_COMPLETE, &completedEvents);
+        handler->registerEvent(event);
+    }
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(event2.get(), sleepCandidate);
+    EXPECT_TRUE(completedEvents.empty());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 2;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(event1.get(), sleepCandidate);
+    ASSERT_EQ(2u, completedEvents.size());
+    EXPECT_EQ(event2.get(), completedEvents[0]);
+    EXPECT_EQ(event3.get(), completedEvents[1]);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 3;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    ASSERT_EQ(3u, completedEvents.size());
+    EXPECT_EQ(event1.get(), completedEvents[2]);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenManyOutstandingEventsWhenTagAdvancesThenOnlyEventsWithReachedTaskCountAreUpdated) {
+    class CountingEvent : public Event {
+      public:
+        CountingEvent(Context *ctx, CommandQueue *cmdQueue, uint32_t taskCount)
+            : Event(ctx, cmdQueue, CL_COMMAND_BARRIER, 0, taskCount) {}
+
+        void updateExecutionStatus() override {
+            updateExecutionStatusCalled++;
+            Event::updateExecutionStatus();
+        }
+
+        uint32_t updateExecutionStatusCalled = 0u;
+    };
+
+    constexpr uint32_t numEvents = 10000u;
+    constexpr uint32_t eventsCompletedPerStep = 1000u;
+
+    std::vector<ReleaseableObjectPtr<CountingEvent>> events;
+    events.reserve(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        events.push_back(makeReleaseable<CountingEvent>(context.get(), commandQueue.get(), i + 1));
+        events.back()->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+        events.back()->updateExecutionStatusCalled = 0u;
+        handler->registerEvent(events.back().get());
+    }
+
+    auto getUpdatesCount = [&events]() {
+        uint32_t updatesCount = 0u;
+        for (auto &event : events) {
+            updatesCount += event->updateExecutionStatusCalled;
+        }
+        return updatesCount;
+    };
+
+    handler->process();
+    EXPECT_EQ(0, counter);
+    EXPECT_EQ(numEvents, getUpdatesCount());
+
+    handler->process();
+    EXPECT_EQ(numEvents, getUpdatesCount());
+
+    for (uint32_t completedEvents = eventsCompletedPerStep; completedEvents <= numEvents; completedEvents += eventsCompletedPerStep) {
+        *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = completedEvents;
+        handler->process();
+        EXPECT_EQ(static_cast<int>(completedEvents), counter);
+        EXPECT_EQ(numEvents + completedEvents, getUpdatesCount());
+    }
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+// OpenCL has no benchmark executable, so this one is disabled and run on demand with --gtest_also_run_disabled_tests.
+// Idle passes with all events outstanding are compared against passes retiring a slice of them as the tag advances.
+TEST_F(AsyncEventsHandlerTests, DISABLED_benchmarkProcessingManyOutstandingEventsAsTagAdvances) {
+    constexpr uint32_t steps = 100u;
+    constexpr size_t idlePasses = 1000u;
+
+    for (uint32_t numEvents : {1000u, 10000u}) {
+        counter = 0;
+        *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 0;
+        std::vector<ReleaseableObjectPtr<Event>> events;
+        events.reserve(numEvents);
+        for (uint32_t i = 0; i < numEvents; i++) {
+            events.push_back(makeReleaseable<Event>(commandQueue.get(), CL_COMMAND_BARRIER, 0, i + 1));
+            events.back()->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+            handler->registerEvent(events.back().get());
+        }
+        handler->process();
+
+        auto variant = std::to_string(numEvents) + " outstanding events";
+        auto seconds = Benchmark::measure(idlePasses, [&]() { handler->process(); });
+        Benchmark::reportOperations("async events idle pass", variant.c_str(), seconds, 1u);
+        EXPECT_EQ(0, counter);
+
+        const auto eventsPerStep = numEvents / steps;
+        seconds = Benchmark::measure(1u, [&]() {
+            for (uint32_t completedEvents = eventsPerStep; completedEvents <= numEvents; completedEvents += eventsPerStep) {
+                *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = completedEvents;
+                handler->process();
+            }
+        });
+        Benchmark::reportOperations("async events retirement", variant.c_str(), seconds, numEvents);
+        EXPECT_EQ(static_cast<int>(numEvents), counter);
+        EXPECT_TRUE(handler->peekIsListEmpty());
+    }
+}
+
 TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontReturnAsSleepCandidate) {
     event1->setTaskStamp(0, 1);
     event2->setTaskStamp(0, 2);
@@ -49,6 +49,10 @@ TEST(ApiSpecificConfigOclTests, WhenCheckingIfDeviceAllocationCacheIsEnabledThen
     EXPECT_FALSE(ApiSpecificConfig::isDeviceAllocationCacheEnabled());
 }
 
+TEST(ApiSpecificConfigOclTests, WhenCheckingIfHostAllocationCacheIsEnabledThenReturnFalse) {
+    EXPECT_FALSE(ApiSpecificConfig::isHostAllocationCacheEnabled());
+}
+
 TEST(ApiSpecificConfigOclTests, givenEnableStatelessCompressionWhenProvidingSvmGpuAllocationThenPreferCompressedBuffer) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.RenderCompressedBuffersEnabled.set(1);
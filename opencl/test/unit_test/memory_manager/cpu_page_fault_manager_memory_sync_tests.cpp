@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -66,7 +67,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnq
     EXPECT_EQ(cmdQ->transferToGpuCalled, 0);
     EXPECT_EQ(cmdQ->finishCalled, 0);
 
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, alloc, cmdQ.get());
     EXPECT_EQ(cmdQ->transferToCpuCalled, 1);
     EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
     EXPECT_EQ(cmdQ->finishCalled, 1);
@@ -99,9 +100,46 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
 
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 0);
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, alloc, cmdQ.get());
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 1);
 
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+TEST_F(PageFaultManagerTest, givenRangeWithinUnifiedMemoryAllocWhenGpuTransferIsInvokedThenMapOperationIsInsertedForThisRange) {
+    MockExecutionEnvironment executionEnvironment;
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+
+    struct MockSVMAllocsManager : SVMAllocsManager {
+        using SVMAllocsManager::SVMAllocsManager;
+        void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap) override {
+            SVMAllocsManager::insertSvmMapOperation(regionSvmPtr, regionSize, baseSvmPtr, offset, readOnlyMap);
+            passedRegionSize = regionSize;
+            passedBaseSvmPtr = baseSvmPtr;
+            passedOffset = offset;
+        }
+        size_t passedRegionSize = 0u;
+        void *passedBaseSvmPtr = nullptr;
+        size_t passedOffset = 0u;
+    };
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get(), false);
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    void *alloc = svmAllocsManager->createSVMAlloc(4 * MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    auto cmdQ = std::make_unique<CommandQueueMock>();
+    cmdQ->device = device.get();
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, svmAllocsManager.get(), cmdQ.get(), {});
+
+    pageFaultManager->baseGpuTransfer(ptrOffset(alloc, MemoryConstants::pageSize), MemoryConstants::pageSize, alloc, cmdQ.get());
+    EXPECT_EQ(MemoryConstants::pageSize, svmAllocsManager->passedRegionSize);
+    EXPECT_EQ(alloc, svmAllocsManager->passedBaseSvmPtr);
+    EXPECT_EQ(MemoryConstants::pageSize, svmAllocsManager->passedOffset);
+    EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
+
+    svmAllocsManager->freeSVMAlloc(alloc);
+    cmdQ->device = nullptr;
+}
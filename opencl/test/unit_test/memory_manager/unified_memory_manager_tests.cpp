@@ -181,6 +181,122 @@ TEST_F(SVMMemoryAllocatorTest, whenGetSVMAllocationFromOutsideOfReturnedPointerA
     svmManager->freeSVMAlloc(ptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, givenAllocationResolvedOnceWhenLookingUpPointersInItsRangeThenLookupCacheReturnsIt) {
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(nullptr, svmManager->SVMAllocs.getFromLookupCache(ptr));
+
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    EXPECT_EQ(svmData, svmManager->SVMAllocs.getFromLookupCache(ptr));
+    EXPECT_EQ(svmData, svmManager->SVMAllocs.getFromLookupCache(ptrOffset(ptr, MemoryConstants::pageSize - 4)));
+    EXPECT_EQ(nullptr, svmManager->SVMAllocs.getFromLookupCache(ptrOffset(ptr, -4)));
+    EXPECT_EQ(nullptr, svmManager->SVMAllocs.getFromLookupCache(ptrOffset(ptr, MemoryConstants::pageSize)));
+    EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize - 4)));
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenAllocationInLookupCacheWhenItIsFreedThenItIsNotReturnedAnymore) {
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    auto otherPtr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, otherPtr);
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(otherPtr));
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(nullptr, svmManager->SVMAllocs.getFromLookupCache(ptr));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+
+    svmManager->freeSVMAlloc(otherPtr);
+    EXPECT_EQ(nullptr, svmManager->SVMAllocs.getFromLookupCache(otherPtr));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(otherPtr));
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenAllocationInLookupCacheWhenUnrelatedAllocationIsFreedThenItIsStillReturned) {
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    auto otherPtr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, otherPtr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    svmManager->freeSVMAlloc(otherPtr);
+    EXPECT_EQ(svmData, svmManager->SVMAllocs.getFromLookupCache(ptr));
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenAllocationInLookupCacheWhenMoreAllocationsThanRemovalsLogSizeAreFreedThenItIsResolvedAgainFromMap) {
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    for (uint64_t i = 0; i <= MockMapBasedAllocationTracker::removedRangesLogSize; i++) {
+        auto otherPtr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+        ASSERT_NE(nullptr, otherPtr);
+        svmManager->freeSVMAlloc(otherPtr);
+    }
+    EXPECT_EQ(nullptr, svmManager->SVMAllocs.getFromLookupCache(ptr));
+    EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptr));
+    EXPECT_EQ(svmData, svmManager->SVMAllocs.getFromLookupCache(ptr));
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenWorkingSetOfManyAllocationsWhenTheyAreResolvedOnceThenAllWithoutCacheSetConflictAreReturnedFromLookupCache) {
+    constexpr size_t numAllocations = 20u;
+    std::vector<void *> ptrs;
+    std::vector<SvmAllocationData *> svmDatas;
+    std::map<size_t, size_t> usedCacheSets;
+    for (size_t i = 0; i < numAllocations; i++) {
+        auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+        ASSERT_NE(nullptr, ptr);
+        ptrs.push_back(ptr);
+        svmDatas.push_back(svmManager->getSVMAlloc(ptr));
+        usedCacheSets[MockMapBasedAllocationTracker::getLookupCacheSetIndex(reinterpret_cast<uintptr_t>(ptr))]++;
+    }
+
+    for (size_t i = 0; i < numAllocations; i++) {
+        if (usedCacheSets[MockMapBasedAllocationTracker::getLookupCacheSetIndex(reinterpret_cast<uintptr_t>(ptrs[i]))] <= MockMapBasedAllocationTracker::LookupCache::numWays) {
+            EXPECT_EQ(svmDatas[i], svmManager->SVMAllocs.getFromLookupCache(ptrs[i]));
+        }
+        EXPECT_EQ(svmDatas[i], svmManager->getSVMAlloc(ptrs[i]));
+    }
+
+    for (auto ptr : ptrs) {
+        svmManager->freeSVMAlloc(ptr);
+    }
+}
+
+TEST(SVMAllocsLookupCacheTest, givenContiguousAllocationsAlignedTo64KBWhenComputingLookupCacheSetsThenEachUsesDifferentSet) {
+    std::set<size_t> usedCacheSets;
+    for (uintptr_t i = 1; i <= MockMapBasedAllocationTracker::LookupCache::numSets / 2; i++) {
+        usedCacheSets.insert(MockMapBasedAllocationTracker::getLookupCacheSetIndex(0x100000000ull + i * MemoryConstants::pageSize64k));
+    }
+    EXPECT_EQ(MockMapBasedAllocationTracker::LookupCache::numSets / 2, usedCacheSets.size());
+}
+
+TEST(SVMAllocsLookupCacheTest, givenPointersWithinSame64KBWhenComputingLookupCacheSetsThenSameSetIsUsed) {
+    const uintptr_t base = 0x100000000ull + MemoryConstants::pageSize64k;
+    EXPECT_EQ(MockMapBasedAllocationTracker::getLookupCacheSetIndex(base), MockMapBasedAllocationTracker::getLookupCacheSetIndex(base + MemoryConstants::pageSize64k - 1));
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenAllocationInLookupCacheOfOneManagerWhenLookingItUpInAnotherManagerThenItIsNotFound) {
+    auto otherSvmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get(), false);
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+
+    EXPECT_EQ(nullptr, otherSvmManager->SVMAllocs.getFromLookupCache(ptr));
+    EXPECT_EQ(nullptr, otherSvmManager->getSVMAlloc(ptr));
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
 TEST_F(SVMMemoryAllocatorTest, whenCouldNotAllocateInMemoryManagerThenReturnsNullAndDoesNotChangeAllocsMap) {
     FailMemoryManager failMemoryManager(executionEnvironment);
     svmManager->memoryManager = &failMemoryManager;
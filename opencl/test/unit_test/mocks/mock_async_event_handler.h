@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,7 +59,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && isSubmittedEventsEmpty(); }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
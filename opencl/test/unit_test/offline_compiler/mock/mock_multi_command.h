@@ -19,14 +19,18 @@ namespace NEO {
 class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
+    using MultiCommand::buildTimes;
+    using MultiCommand::jobs;
     using MultiCommand::lines;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
+    using MultiCommand::timeSummaryFile;
 
     using MultiCommand::addAdditionalOptionsToSingleCommandLine;
     using MultiCommand::initialize;
     using MultiCommand::printHelp;
     using MultiCommand::runBuilds;
+    using MultiCommand::saveTimeSummary;
     using MultiCommand::showResults;
     using MultiCommand::singleBuild;
     using MultiCommand::splitLineInSeparateArgs;
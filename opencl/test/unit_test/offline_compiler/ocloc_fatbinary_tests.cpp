@@ -1215,6 +1215,82 @@ TEST_F(OclocFatBinaryTest, givenBitFlagsWhenBuildingFatbinaryThenFilesInArchiveH
     }
 }
 
+TEST_F(OclocFatBinaryTest, givenJobsFlagWhenBuildingFatbinaryThenArchiveIsSameAsForSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef() = MessagePrinter{true};
+    auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-j");
+    args.push_back("2");
+
+    buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OclocErrorCode::SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST(OclocFatBinaryHelpersTest, givenJobsArgumentWhenGettingJobsCountThenOnlyPositiveDecimalValueIsAccepted) {
+    EXPECT_EQ(1u, getFatBinaryJobsCount("1"));
+    EXPECT_EQ(8u, getFatBinaryJobsCount("8"));
+    EXPECT_EQ(123456789u, getFatBinaryJobsCount("123456789"));
+
+    EXPECT_EQ(0u, getFatBinaryJobsCount(""));
+    EXPECT_EQ(0u, getFatBinaryJobsCount("0"));
+    EXPECT_EQ(0u, getFatBinaryJobsCount("-3"));
+    EXPECT_EQ(0u, getFatBinaryJobsCount("+3"));
+    EXPECT_EQ(0u, getFatBinaryJobsCount("abc"));
+    EXPECT_EQ(0u, getFatBinaryJobsCount("4x"));
+    EXPECT_EQ(0u, getFatBinaryJobsCount("99999999999999999999"));
+}
+
+TEST_F(OclocFatBinaryTest, givenInvalidJobsArgumentWhenBuildingFatbinaryThenErrorIsReturned) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    for (const std::string jobs : {"0", "-3", "abc"}) {
+        const std::vector<std::string> args = {
+            "ocloc",
+            "-output",
+            outputArchiveName,
+            "-file",
+            spirvFilename,
+            "-spirv_input",
+            "-device",
+            devices,
+            "-j",
+            jobs};
+
+        testing::internal::CaptureStdout();
+        const auto buildResult = buildFatBinary(args, &mockArgHelper);
+        const auto output{testing::internal::GetCapturedStdout()};
+
+        EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, buildResult);
+        EXPECT_EQ("Error! Invalid number of jobs: " + jobs + "\n", output);
+        EXPECT_EQ(0u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    }
+}
+
 TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArchiveIsStoredInThatDirectory) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
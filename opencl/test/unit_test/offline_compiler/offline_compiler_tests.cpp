@@ -320,6 +320,122 @@ TEST_F(MultiCommandTests, GivenOutputFileListFlagWhenBuildingMultiCommandThenSuc
     delete pMultiCommand;
 }
 
+TEST_F(MultiCommandTests, GivenJobsCountWhenBuildingMultiCommandThenAllCommandsAreBuiltAndReportedInOrder) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "2",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+    EXPECT_TRUE(fileExists(outFileList));
+
+    std::string expectedFileList;
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+        expectedFileList += getCurrentDirectoryOwn(pMultiCommand->outDirForBuilds) + "build_no_" + std::to_string(i + 1) + ".bin\n";
+    }
+
+    size_t fileListSize = 0;
+    auto fileList = loadDataFromFile(outFileList.c_str(), fileListSize);
+    ASSERT_NE(nullptr, fileList);
+    EXPECT_EQ(expectedFileList, std::string(fileList.get(), fileListSize));
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+
+TEST_F(MultiCommandTests, GivenJobsCountInVerboseModeWhenBuildingMultiCommandThenOutputIsSameAsForSequentialBuild) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    std::string outputs[2];
+    for (auto jobs : {1, 2}) {
+        std::vector<std::string> argv = {
+            "ocloc",
+            "multi",
+            nameOfFileWithArgs.c_str(),
+            "-j",
+            std::to_string(jobs)};
+
+        ::testing::internal::CaptureStdout();
+        pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+        outputs[jobs - 1] = ::testing::internal::GetCapturedStdout();
+
+        EXPECT_NE(nullptr, pMultiCommand);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        delete pMultiCommand;
+    }
+
+    EXPECT_NE(std::string::npos, outputs[0].find("Command number 4: \n"));
+    EXPECT_EQ(outputs[0], outputs[1]);
+
+    deleteFileWithArgs();
+}
+
+TEST(MultiCommandWhiteboxTest, GivenTimeSummaryFileWhenSavingTimeSummaryThenResultAndTimeOfEachCommandAreSaved) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.uniqueHelper->interceptOutput = true;
+    mockMultiCommand.lines = {"-file a.cl -device tgllp", "-file b.cl -device tgllp"};
+    mockMultiCommand.retValues = {OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE};
+    mockMultiCommand.buildTimes = {1.5, 20.25};
+    mockMultiCommand.timeSummaryFile = "summary.csv";
+
+    mockMultiCommand.saveTimeSummary();
+
+    const auto &interceptedFiles = mockMultiCommand.uniqueHelper->interceptedFiles;
+    ASSERT_EQ(1u, interceptedFiles.count("summary.csv"));
+    const auto expectedSummary{"command,result,time_ms,arguments\n"
+                               "1,0,1.500,\"-file a.cl -device tgllp\"\n"
+                               "2,-5151,20.250,\"-file b.cl -device tgllp\"\n"};
+    EXPECT_EQ(expectedSummary, interceptedFiles.at("summary.csv"));
+}
+
+TEST(MultiCommandWhiteboxTest, GivenCommandLineWithQuotesWhenSavingTimeSummaryThenQuotesAreEscaped) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.uniqueHelper->interceptOutput = true;
+    mockMultiCommand.lines = {"-file a.cl -device tgllp -options \"-cl-opt-disable -DX=1\""};
+    mockMultiCommand.retValues = {OclocErrorCode::SUCCESS};
+    mockMultiCommand.buildTimes = {1.5};
+    mockMultiCommand.timeSummaryFile = "summary.csv";
+
+    mockMultiCommand.saveTimeSummary();
+
+    const auto &interceptedFiles = mockMultiCommand.uniqueHelper->interceptedFiles;
+    ASSERT_EQ(1u, interceptedFiles.count("summary.csv"));
+    const auto expectedSummary{"command,result,time_ms,arguments\n"
+                               "1,0,1.500,\"-file a.cl -device tgllp -options \"\"-cl-opt-disable -DX=1\"\"\"\n"};
+    EXPECT_EQ(expectedSummary, interceptedFiles.at("summary.csv"));
+}
+
 TEST(MultiCommandWhiteboxTest, GivenVerboseModeWhenShowingResultsThenLogsArePrintedForEachBuild) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.retValues = {OclocErrorCode::SUCCESS, OclocErrorCode::INVALID_FILE};
@@ -522,6 +638,27 @@ TEST(MultiCommandWhiteboxTest, GivenInvalidArgsWhenInitializingThenErrorIsReturn
     EXPECT_NE(std::string::npos, errorPosition);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenInvalidJobsCountWhenInitializingThenErrorIsReturned) {
+    for (const std::string jobs : {"0", "-3", "abc"}) {
+        MockMultiCommand mockMultiCommand{};
+        mockMultiCommand.quiet = false;
+
+        const std::vector<std::string> args = {
+            "ocloc",
+            "multi",
+            "commands.txt",
+            "-j",
+            jobs};
+
+        ::testing::internal::CaptureStdout();
+        const auto result = mockMultiCommand.initialize(args);
+        const auto output = testing::internal::GetCapturedStdout();
+
+        EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+        EXPECT_EQ("Error! Invalid number of jobs: " + jobs + "\n", output);
+    }
+}
+
 using MockOfflineCompilerTests = ::testing::Test;
 TEST_F(MockOfflineCompilerTests, givenProductConfigValueAndRevisionIdWhenInitHwInfoThenTheseValuesAreSet) {
     MockOfflineCompiler mockOfflineCompiler;
@@ -925,6 +1062,46 @@ TEST_F(OfflineCompilerTests, givenIncorrectConfigFlagWhenParsingCommandLineThenE
     EXPECT_EQ(expectedErrorMessage, output);
 }
 
+TEST_F(OfflineCompilerTests, givenJobsFlagForSingleDeviceWhenParsingCommandLineThenItIsAccepted) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "compile",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-j",
+        "4"};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+
+    const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+    EXPECT_EQ(OclocErrorCode::SUCCESS, result);
+}
+
+TEST_F(OfflineCompilerTests, givenInvalidJobsFlagWhenParsingCommandLineThenErrorLogIsPrintedAndFailureIsReturned) {
+    for (const std::string jobs : {"0", "-3", "abc"}) {
+        const std::vector<std::string> argv = {
+            "ocloc",
+            "compile",
+            "-file",
+            clFiles + "copybuffer.cl",
+            "-device",
+            gEnvironment->devicePrefix.c_str(),
+            "-j",
+            jobs};
+
+        MockOfflineCompiler mockOfflineCompiler{};
+
+        ::testing::internal::CaptureStdout();
+        const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+        const auto output{::testing::internal::GetCapturedStdout()};
+
+        EXPECT_EQ(OclocErrorCode::INVALID_COMMAND_LINE, result);
+        EXPECT_EQ("Error: Invalid number of jobs " + jobs + ".\n", output);
+    }
+}
+
 TEST_F(OfflineCompilerTests, Given64BitModeFlagWhenParsingThenInternalOptionsContain64BitModeFlag) {
     const std::array<std::string, 2> flagsToTest = {
         "-64", CompilerOptions::arch64bit.str()};
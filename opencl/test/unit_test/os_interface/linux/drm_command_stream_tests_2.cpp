@@ -73,7 +73,7 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenCommandStreamWhenItIsFlush
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenTaskThatRequiresLargeResourceCountWhenItIsFlushedThenExecStorageIsResized) {
     std::vector<GraphicsAllocation *> graphicsAllocations;
 
-    auto &execStorage = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->execObjectsStorage;
+    auto &execStorage = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->execObjectsCaches[0].execObjects;
     execStorage.resize(0);
 
     for (auto id = 0; id < 10; id++) {
@@ -1611,7 +1611,7 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocInMemoryOperationsInt
                 mockExecObject.getOffset() == static_cast<DrmAllocation *>(allocation)->getBO()->peekAddress());
     };
 
-    auto &residency = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->execObjectsStorage;
+    auto &residency = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->execObjectsCaches[0].execObjects;
     EXPECT_TRUE(std::find_if(residency.begin(), residency.end(), execObjectRequirements) != residency.end());
     EXPECT_EQ(residency.size(), 2u);
     residency.clear();
@@ -1632,3 +1632,146 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocInMemoryOperationsInt
     mm->freeGraphicsMemory(allocation);
     mm->freeGraphicsMemory(commandBuffer);
 }
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenUnchangedResidencyWhenFlushedAgainThenExecObjectsAreReused) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    std::vector<GraphicsAllocation *> graphicsAllocations;
+    for (auto id = 0; id < 3; id++) {
+        auto graphicsAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+        csr->makeResident(*graphicsAllocation);
+        graphicsAllocations.push_back(graphicsAllocation);
+    }
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, testedCsr->lastReusedExecObjectsCount);
+    EXPECT_EQ(4u, this->mock->execBuffer.getBufferCount());
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(3u, testedCsr->lastReusedExecObjectsCount);
+    EXPECT_EQ(4u, this->mock->execBuffer.getBufferCount());
+
+    auto &execObjects = testedCsr->execObjectsCaches[0].execObjects;
+    for (auto id = 0u; id < graphicsAllocations.size(); id++) {
+        auto bo = static_cast<DrmAllocation *>(graphicsAllocations[id])->getBO();
+        auto &execObject = static_cast<const MockExecObject &>(execObjects[id]);
+        EXPECT_EQ(static_cast<uint32_t>(bo->peekHandle()), execObject.getHandle());
+        EXPECT_EQ(bo->peekAddress(), execObject.getOffset());
+    }
+
+    auto newAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    csr->makeResident(*newAllocation);
+    graphicsAllocations.push_back(newAllocation);
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, testedCsr->lastReusedExecObjectsCount);
+    EXPECT_EQ(5u, this->mock->execBuffer.getBufferCount());
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(4u, testedCsr->lastReusedExecObjectsCount);
+
+    for (auto graphicsAllocation : graphicsAllocations) {
+        mm->freeGraphicsMemory(graphicsAllocation);
+    }
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenBufferObjectStateChangedAfterFlushWhenFlushedAgainThenExecObjectsAreRefilled) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    auto allocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    csr->makeResident(*allocation);
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(1u, testedCsr->lastReusedExecObjectsCount);
+
+    auto generation = BufferObject::getStateGeneration();
+    allocation->getBO()->markForCapture();
+    EXPECT_NE(generation, BufferObject::getStateGeneration());
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, testedCsr->lastReusedExecObjectsCount);
+
+    generation = BufferObject::getStateGeneration();
+    allocation->getBO()->setAddress(allocation->getBO()->peekAddress());
+    EXPECT_NE(generation, BufferObject::getStateGeneration());
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, testedCsr->lastReusedExecObjectsCount);
+
+    generation = BufferObject::getStateGeneration();
+    auto otherAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    EXPECT_NE(generation, BufferObject::getStateGeneration());
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, testedCsr->lastReusedExecObjectsCount);
+
+    mm->freeGraphicsMemory(otherAllocation);
+    mm->freeGraphicsMemory(allocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenExecObjectsCacheDisabledWhenFlushedAgainThenExecObjectsAreRefilled) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    testedCsr->useExecObjectsCache = false;
+
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    csr->makeResident(*allocation);
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, testedCsr->lastReusedExecObjectsCount);
+    EXPECT_EQ(2u, this->mock->execBuffer.getBufferCount());
+
+    mm->freeGraphicsMemory(allocation);
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenSubmissionsReplayedWithGrowingBufferObjectCountWhenFlushingThenOnlyFirstSubmissionOfEachSetFillsExecObjects) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    constexpr uint32_t submissionsPerSet = 8u;
+    std::vector<GraphicsAllocation *> graphicsAllocations;
+    for (auto boCount : {16u, 128u, 512u}) {
+        while (graphicsAllocations.size() < boCount) {
+            auto graphicsAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+            csr->makeResident(*graphicsAllocation);
+            graphicsAllocations.push_back(graphicsAllocation);
+        }
+
+        size_t reusedExecObjects = 0u;
+        for (auto submission = 0u; submission < submissionsPerSet; submission++) {
+            EXPECT_EQ(SubmissionStatus::SUCCESS, csr->flush(batchBuffer, csr->getResidencyAllocations()));
+            EXPECT_EQ(boCount + 1, this->mock->execBuffer.getBufferCount());
+            reusedExecObjects += testedCsr->lastReusedExecObjectsCount;
+        }
+        EXPECT_EQ(static_cast<size_t>(boCount) * (submissionsPerSet - 1), reusedExecObjects);
+    }
+
+    for (auto graphicsAllocation : graphicsAllocations) {
+        mm->freeGraphicsMemory(graphicsAllocation);
+    }
+    mm->freeGraphicsMemory(commandBuffer);
+}
@@ -28,6 +28,7 @@
 #include <mutex>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -37,12 +38,19 @@ class DrmMockForWorker : public Drm {
     std::mutex mutex;
     std::atomic<int> gem_close_cnt;
     std::atomic<int> gem_close_expected;
+    std::atomic<int> gem_wait_cnt{0};
     std::atomic<std::thread::id> ioctl_caller_thread_id;
+    std::vector<uint32_t> closedHandles;
     DrmMockForWorker(RootDeviceEnvironment &rootDeviceEnvironment) : Drm(std::make_unique<HwDeviceIdDrm>(mockFd, mockPciPath), rootDeviceEnvironment) {
     }
     int ioctl(DrmIoctl request, void *arg) override {
-        if (request == DrmIoctl::GemClose)
+        if (request == DrmIoctl::GemClose) {
             gem_close_cnt++;
+            std::lock_guard<std::mutex> lock(mutex);
+            closedHandles.push_back(static_cast<GemClose *>(arg)->handle);
+        }
+        if (request == DrmIoctl::GemWait)
+            gem_wait_cnt++;
 
         ioctl_caller_thread_id = std::this_thread::get_id();
 
@@ -188,3 +196,80 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchWithRepeatedBufferObjectWhenProcessedThenCompletionIsWaitedOncePerBufferObject) {
+    struct mockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::processBatch;
+        using DrmGemCloseWorker::workCount;
+    };
+    this->drmMock->gem_close_expected = 2;
+
+    std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
+    auto bo1 = new BufferObject(this->drmMock, 3, 1, 0, 1);
+    auto bo2 = new BufferObject(this->drmMock, 3, 2, 0, 1);
+    bo1->reference();
+    bo1->reference();
+
+    std::vector<BufferObject *> batch = {bo1, bo2, bo1, bo1};
+    worker->workCount += static_cast<uint32_t>(batch.size());
+    worker->processBatch(batch);
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(this->drmMock->isVmBindAvailable() ? 0 : 2, this->drmMock->gem_wait_cnt.load());
+    EXPECT_EQ(2, this->drmMock->gem_close_cnt.load());
+
+    auto statistics = worker->getBatchStatistics();
+    EXPECT_EQ(1u, statistics.batchCount);
+    EXPECT_EQ(4u, statistics.closedCount);
+    EXPECT_EQ(4u, statistics.maxBatchSize);
+    EXPECT_LE(statistics.minTime, statistics.maxTime);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsPushedWhenQueueIsProcessedThenTheyAreClosedInPushOrder) {
+    struct mockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::processQueue;
+    };
+    this->drmMock->gem_close_expected = 3;
+
+    std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
+    worker->close(true);
+
+    worker->push(new BufferObject(this->drmMock, 3, 2, 0, 1));
+    worker->push(new BufferObject(this->drmMock, 3, 3, 0, 1));
+    worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+    worker->processQueue();
+
+    EXPECT_TRUE(worker->isEmpty());
+    std::vector<uint32_t> expectedHandles = {2u, 3u, 1u};
+    EXPECT_EQ(expectedHandles, this->drmMock->closedHandles);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsPushedFromMultipleThreadsWhenWorkerFinishesThenAllAreClosedInBatches) {
+    constexpr int threadsCount = 4;
+    constexpr int bosPerThread = 256;
+    this->drmMock->gem_close_expected = threadsCount * bosPerThread;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadsCount; i++) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < bosPerThread; j++) {
+                worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    auto statistics = worker->getBatchStatistics();
+    EXPECT_EQ(static_cast<uint64_t>(threadsCount * bosPerThread), statistics.closedCount);
+    EXPECT_LE(1u, statistics.batchCount);
+    EXPECT_GE(statistics.closedCount, statistics.batchCount);
+}
@@ -112,14 +112,13 @@ class PatchtokensProgramWithDebugData : public MockProgram {
         this->buildInfos.resize(rootDeviceIdx + 1);
         auto &buildInfo = this->buildInfos[rootDeviceIdx];
 
+        SProgramBinaryHeader programBinaryHeader = {};
+        programBinaryHeader.Magic = iOpenCL::MAGIC_CL;
+        programBinaryHeader.Version = iOpenCL::CURRENT_ICBE_VERSION;
+        programBinaryHeader.Device = hwInfo.platform.eRenderCoreFamily;
+        programBinaryHeader.GPUPointerSizeInBytes = sizeof(uintptr_t);
         buildInfo.unpackedDeviceBinarySize = sizeof(SProgramBinaryHeader);
-        buildInfo.unpackedDeviceBinary = std::make_unique<char[]>(buildInfo.unpackedDeviceBinarySize);
-        memset(buildInfo.unpackedDeviceBinary.get(), 0, buildInfo.unpackedDeviceBinarySize);
-        auto programBinaryHeader = reinterpret_cast<SProgramBinaryHeader *>(buildInfo.unpackedDeviceBinary.get());
-        programBinaryHeader->Magic = iOpenCL::MAGIC_CL;
-        programBinaryHeader->Version = iOpenCL::CURRENT_ICBE_VERSION;
-        programBinaryHeader->Device = hwInfo.platform.eRenderCoreFamily;
-        programBinaryHeader->GPUPointerSizeInBytes = sizeof(uintptr_t);
+        buildInfo.unpackedDeviceBinary = makeCopy(&programBinaryHeader, sizeof(SProgramBinaryHeader));
 
         buildInfo.debugData = std::make_unique<char[]>(0x10);
         buildInfo.debugDataSize = 0x10;
@@ -1602,7 +1601,7 @@ TEST(ProgramFromBinaryTests, givenEmptyProgramThenErrorIsReturned) {
     EXPECT_EQ(CL_SUCCESS, retVal);
 
     auto rootDeviceIndex = mockRootDeviceIndex;
-    pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary.reset(nullptr);
+    pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary.reset();
     retVal = pProgram->processGenBinary(*device);
     EXPECT_EQ(CL_INVALID_BINARY, retVal);
 }
@@ -2771,9 +2770,9 @@ TEST(CreateProgramFromBinaryTests, givenBinaryProgramWhenKernelRebulildIsNotForc
     auto rootDeviceIndex = clDevice->getRootDeviceIndex();
     retVal = pProgram->createProgramFromBinary(programTokens.storage.data(), programTokens.storage.size(), *clDevice);
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_NE(nullptr, reinterpret_cast<uint8_t *>(pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()));
+    EXPECT_NE(nullptr, reinterpret_cast<const uint8_t *>(pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()));
     EXPECT_EQ(programTokens.storage.size(), pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
-    EXPECT_NE(nullptr, reinterpret_cast<uint8_t *>(pProgram->buildInfos[rootDeviceIndex].packedDeviceBinary.get()));
+    EXPECT_NE(nullptr, reinterpret_cast<const uint8_t *>(pProgram->buildInfos[rootDeviceIndex].packedDeviceBinary.get()));
     EXPECT_EQ(programTokens.storage.size(), pProgram->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
 }
 
@@ -3106,6 +3105,20 @@ TEST(ProgramReplaceDeviceBinary, GivenBinaryZebinThenUseAsBothPackedAndUnpackedB
     ASSERT_NE(nullptr, program.buildInfos[rootDeviceIndex].unpackedDeviceBinary);
     EXPECT_EQ(0, memcmp(program.buildInfos[rootDeviceIndex].packedDeviceBinary.get(), zebin.storage.data(), program.buildInfos[rootDeviceIndex].packedDeviceBinarySize));
     EXPECT_EQ(0, memcmp(program.buildInfos[rootDeviceIndex].unpackedDeviceBinary.get(), zebin.storage.data(), program.buildInfos[rootDeviceIndex].unpackedDeviceBinarySize));
+    EXPECT_EQ(program.buildInfos[rootDeviceIndex].packedDeviceBinary, program.buildInfos[rootDeviceIndex].unpackedDeviceBinary);
+}
+
+TEST(ProgramReplaceDeviceBinary, GivenZeInfoBlobOfPreviousBinaryThenItIsReleased) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    MockContext context;
+    auto device = context.getDevice(0);
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    MockProgram program{&context, false, toClDeviceVector(*device)};
+    program.buildInfos[rootDeviceIndex].zeInfoBlob = makeCopy("blob", 4);
+    program.buildInfos[rootDeviceIndex].zeInfoBlobSize = 4;
+    program.replaceDeviceBinary(makeCopy(zebin.storage.data(), zebin.storage.size()), zebin.storage.size(), rootDeviceIndex);
+    EXPECT_EQ(nullptr, program.buildInfos[rootDeviceIndex].zeInfoBlob);
+    EXPECT_EQ(0U, program.buildInfos[rootDeviceIndex].zeInfoBlobSize);
 }
 
 TEST(ProgramCallbackTest, whenFunctionIsNullptrThenUserDataNeedsToBeNullptr) {
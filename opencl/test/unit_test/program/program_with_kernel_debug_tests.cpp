@@ -376,9 +376,7 @@ TEST_F(ProgramWithKernelDebuggingTest, givenProgramWithNonZebinaryFormatAndKerne
     auto mockElfData = mockElf->storage.data();
 
     pProgram->buildInfos[pDevice->getRootDeviceIndex()].unpackedDeviceBinarySize = mockElfSize;
-    pProgram->buildInfos[pDevice->getRootDeviceIndex()].unpackedDeviceBinary.reset(new char[mockElfSize]);
-    memcpy_s(pProgram->buildInfos[pDevice->getRootDeviceIndex()].unpackedDeviceBinary.get(), pProgram->buildInfos[pDevice->getRootDeviceIndex()].unpackedDeviceBinarySize,
-             mockElfData, mockElfSize);
+    pProgram->buildInfos[pDevice->getRootDeviceIndex()].unpackedDeviceBinary = makeCopy(mockElfData, mockElfSize);
 
     KernelInfo *mockKernelInfo = new KernelInfo{};
     mockKernelInfo->kernelDescriptor.kernelMetadata.kernelName = "CopyBuffer";
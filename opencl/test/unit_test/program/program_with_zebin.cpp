@@ -29,9 +29,7 @@ void ProgramWithZebinFixture::addEmptyZebin(NEO::MockProgram *program) {
     auto zebin = ZebinTestData::ValidEmptyProgram<>();
 
     program->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = zebin.storage.size();
-    program->buildInfos[rootDeviceIndex].unpackedDeviceBinary.reset(new char[zebin.storage.size()]);
-    memcpy_s(program->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get(), program->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize,
-             zebin.storage.data(), zebin.storage.size());
+    program->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy(zebin.storage.data(), zebin.storage.size());
 }
 
 void ProgramWithZebinFixture::populateProgramWithSegments(NEO::MockProgram *program) {
@@ -12,6 +12,7 @@
 
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -32,10 +33,30 @@ PRODUCT_FAMILY getProductFamilyFromDeviceName(const std::string &deviceName);
 
 class MessagePrinter {
   public:
+    // Messages of the current thread are collected in buffer while in scope, so that output
+    // of concurrently built commands can be printed later in command order
+    class ScopedBuffer {
+      public:
+        ScopedBuffer(std::string &buffer) : previousBuffer(getThreadBuffer()) {
+            getThreadBuffer() = &buffer;
+        }
+        ~ScopedBuffer() {
+            getThreadBuffer() = previousBuffer;
+        }
+
+      private:
+        std::string *previousBuffer;
+    };
+
     MessagePrinter() = default;
     MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
 
     void printf(const char *message) {
+        if (auto buffer = getThreadBuffer()) {
+            buffer->append(message);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(getPrintMutex());
         if (!suppressMessages) {
             ::printf("%s", message);
         }
@@ -44,6 +65,11 @@ class MessagePrinter {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        if (auto buffer = getThreadBuffer()) {
+            buffer->append(stringFormat(format, std::forward<Args>(args)...));
+            return;
+        }
+        std::lock_guard<std::mutex> lock(getPrintMutex());
         if (!suppressMessages) {
             ::printf(format, std::forward<Args>(args)...);
         }
@@ -57,6 +83,17 @@ class MessagePrinter {
     bool isSuppressed() const { return suppressMessages; }
 
   private:
+    // Targets of fatbinary may be compiled concurrently while sharing one printer
+    static std::mutex &getPrintMutex() {
+        static std::mutex printMutex;
+        return printMutex;
+    }
+
+    static std::string *&getThreadBuffer() {
+        thread_local std::string *buffer = nullptr;
+        return buffer;
+    }
+
     template <typename... Args>
     std::string stringFormat(const std::string &format, Args... args) {
         std::string outputString;
@@ -11,7 +11,12 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
 #include <memory>
+#include <thread>
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
@@ -31,6 +36,10 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
         }
         outFileName += ".bin";
     }
+    return reportSingleBuild(retVal);
+}
+
+int MultiCommand::reportSingleBuild(int retVal) {
     if (retVal == OclocErrorCode::SUCCESS) {
         if (!quiet)
             argHelper->printf("Build succeeded.\n");
@@ -105,6 +114,14 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            jobs = getFatBinaryJobsCount(args[++argIndex]);
+            if (jobs == 0u) {
+                argHelper->printf("Error! Invalid number of jobs: %s\n", args[argIndex].c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+        } else if (hasMoreArgs && ConstStringRef("-time_summary") == currArg) {
+            timeSummaryFile = args[++argIndex];
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -124,11 +141,18 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
         return OclocErrorCode::INVALID_FILE;
     }
 
-    runBuilds(args[0]);
+    if (jobs > 1 && lines.size() > 1) {
+        runBuildsInParallel(args[0]);
+    } else {
+        runBuilds(args[0]);
+    }
 
     if (outputFileList != "") {
         argHelper->saveOutput(outputFileList, outputFile);
     }
+    if (timeSummaryFile != "") {
+        saveTimeSummary();
+    }
     return showResults();
 }
 
@@ -139,6 +163,7 @@ void MultiCommand::runBuilds(const std::string &argZero) {
         int retVal = splitLineInSeparateArgs(args, lines[i], i);
         if (retVal != OclocErrorCode::SUCCESS) {
             retValues.push_back(retVal);
+            buildTimes.push_back(0.0);
             continue;
         }
 
@@ -147,11 +172,126 @@ void MultiCommand::runBuilds(const std::string &argZero) {
         }
 
         addAdditionalOptionsToSingleCommandLine(args, i);
+        auto start = std::chrono::steady_clock::now();
         retVal = singleBuild(args);
+        auto end = std::chrono::steady_clock::now();
         retValues.push_back(retVal);
+        buildTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+}
+
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct CommandBuild {
+        std::unique_ptr<OfflineCompiler> compiler;
+        std::vector<std::string> args;
+        std::string outDirForBuilds;
+        std::string outFileName;
+        std::string output;
+        std::chrono::duration<double, std::milli> time{0.0};
+        int retVal = OclocErrorCode::SUCCESS;
+        bool validCommandLine = false;
+        bool fatBinary = false;
+    };
+    std::vector<CommandBuild> builds(lines.size());
+    std::vector<size_t> compilerBuilds;
+
+    // Compilers are created sequentially as parsing of command line modifies shared OclocArgHelper state
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &build = builds[i];
+        MessagePrinter::ScopedBuffer outputBuffer(build.output);
+        build.args = {argZero};
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        if (build.retVal != OclocErrorCode::SUCCESS) {
+            continue;
+        }
+
+        build.validCommandLine = true;
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.outDirForBuilds = outDirForBuilds;
+        build.outFileName = outFileName;
+        build.fatBinary = requestedFatBinary(build.args, argHelper);
+        if (build.fatBinary) {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        build.compiler.reset(OfflineCompiler::create(build.args.size(), build.args, true, build.retVal, argHelper));
+        build.time += std::chrono::steady_clock::now() - start;
+        build.outFileName += ".bin";
+        if (build.retVal == OclocErrorCode::SUCCESS) {
+            compilerBuilds.push_back(i);
+        }
+    }
+
+    std::atomic<size_t> nextBuild{0u};
+    auto buildWorker = [&]() {
+        for (auto buildId = nextBuild++; buildId < compilerBuilds.size(); buildId = nextBuild++) {
+            auto &build = builds[compilerBuilds[buildId]];
+            MessagePrinter::ScopedBuffer outputBuffer(build.output);
+            auto start = std::chrono::steady_clock::now();
+            build.retVal = build.compiler->build();
+            build.time += std::chrono::steady_clock::now() - start;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto workersCount = std::min(jobs, compilerBuilds.size());
+    for (size_t i = 1; i < workersCount; i++) {
+        workers.emplace_back(buildWorker);
+    }
+    buildWorker();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // Results of each command are reported together and in command file order
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &build = builds[i];
+        if (!build.validCommandLine) {
+            argHelper->printf(build.output.c_str());
+            retValues.push_back(build.retVal);
+            buildTimes.push_back(0.0);
+            continue;
+        }
+
+        if (!quiet) {
+            argHelper->printf("Command number %zu: \n", i + 1);
+        }
+        argHelper->printf(build.output.c_str());
+
+        outDirForBuilds = build.outDirForBuilds;
+        outFileName = build.outFileName;
+        if (build.fatBinary) {
+            auto start = std::chrono::steady_clock::now();
+            build.retVal = buildFatBinary(build.args, argHelper);
+            build.time += std::chrono::steady_clock::now() - start;
+        } else if (build.compiler) {
+            std::string &buildLog = build.compiler->getBuildLog();
+            if (buildLog.empty() == false) {
+                argHelper->printf("%s\n", buildLog.c_str());
+            }
+        }
+
+        retValues.push_back(reportSingleBuild(build.retVal));
+        buildTimes.push_back(build.time.count());
     }
 }
 
+void MultiCommand::saveTimeSummary() {
+    std::stringstream summary;
+    summary << "command,result,time_ms,arguments\n";
+    for (size_t i = 0; i < retValues.size(); ++i) {
+        // quotes inside of quoted field are doubled
+        std::string arguments = i < lines.size() ? lines[i] : "";
+        for (auto quote = arguments.find('\"'); quote != std::string::npos; quote = arguments.find('\"', quote + 2)) {
+            arguments.insert(quote, 1, '\"');
+        }
+        summary << i + 1 << ',' << retValues[i] << ',' << std::fixed << std::setprecision(3) << buildTimes[i] << ",\"" << arguments << "\"\n";
+    }
+    const auto summaryString = summary.str();
+    argHelper->saveOutput(timeSummaryFile, summaryString.c_str(), summaryString.size());
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -167,6 +307,14 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of commands compiled concurrently,
+                                must be a positive number.
+                                Results are reported in command file order.
+                                Default is 1.
+
+  -time_summary <file_name>     Name of optional csv file containing
+                                result and wall time of each command.
+
 )===");
 }
 
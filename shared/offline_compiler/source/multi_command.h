@@ -39,16 +39,22 @@ class MultiCommand {
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
     MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    int reportSingleBuild(int retVal);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsInParallel(const std::string &argZero);
+    void saveTimeSummary();
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
+    std::vector<double> buildTimes;
     std::vector<std::string> lines;
     std::string outFileName;
     std::string pathToCommandFile;
+    std::string timeSummaryFile;
     std::stringstream outputFile;
+    size_t jobs = 1u;
     bool quiet = false;
 };
 } // namespace NEO
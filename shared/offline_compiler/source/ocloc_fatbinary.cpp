@@ -19,9 +19,15 @@
 #include "igfxfmid.h"
 #include "platforms.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <thread>
 
 namespace NEO {
 bool requestedFatBinary(const std::vector<std::string> &args, OclocArgHelper *helper) {
@@ -225,34 +231,114 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
 
     if (retVal == 0) {
         retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+        retVal = appendFatBinaryTargetOutput(retVal, argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
     }
-    if (retVal) {
-        return retVal;
+    return retVal;
+}
+
+int appendFatBinaryTargetOutput(int buildRetVal, const std::vector<std::string> &argsCopy, const std::string &pointerSize, Ar::ArEncoder &fatbinary,
+                                OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
+    if (buildRetVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), buildRetVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+        return buildRetVal;
+    }
+
+    fatbinary.appendFileEntry(pointerSize + "." + getProductConfigForFatBinaryEntry(product), pCompiler->getPackedDeviceBinaryOutput());
+    return buildRetVal;
+}
 
-    std::string productConfig("");
+std::string getProductConfigForFatBinaryEntry(const std::string &product) {
     if (product.find(".") != std::string::npos) {
-        productConfig = product;
-    } else {
-        productConfig = ProductConfigHelper::parseMajorMinorRevisionValue(ProductConfigHelper::getProductConfigForAcronym(product));
+        return product;
     }
+    return ProductConfigHelper::parseMajorMinorRevisionValue(ProductConfigHelper::getProductConfigForAcronym(product));
+}
 
-    fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
-    return retVal;
+size_t getFatBinaryJobsCount(const std::string &jobsArg) {
+    if (jobsArg.empty() || jobsArg.size() > std::numeric_limits<uint32_t>::digits10) {
+        return 0u;
+    }
+    size_t jobs = 0u;
+    for (auto c : jobsArg) {
+        if (c < '0' || c > '9') {
+            return 0u;
+        }
+        jobs = jobs * 10u + static_cast<size_t>(c - '0');
+    }
+    return jobs;
+}
+
+int buildFatBinaryForTargetsInParallel(std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts, size_t jobs,
+                                       const std::string &pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper) {
+    const auto targetsCount = targetProducts.size();
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers(targetsCount);
+    std::vector<size_t> buildIndices(targetsCount);
+    std::vector<size_t> uniqueBuilds;
+    std::map<std::string, size_t> buildIndexForProductConfig;
+
+    // Compilers are created sequentially as initialization modifies shared OclocArgHelper state,
+    // targets resolving to the same product config are compiled only once.
+    for (size_t i = 0; i < targetsCount; i++) {
+        const auto product = targetProducts[i].str();
+        auto productConfig = getProductConfigForFatBinaryEntry(product);
+        auto it = buildIndexForProductConfig.find(productConfig);
+        if (it != buildIndexForProductConfig.end()) {
+            buildIndices[i] = it->second;
+            continue;
+        }
+
+        int retVal = 0;
+        argsCopy[deviceArgIndex] = product;
+        compilers[i].reset(OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper));
+        if (OclocErrorCode::SUCCESS != retVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return retVal;
+        }
+        buildIndices[i] = i;
+        buildIndexForProductConfig[productConfig] = i;
+        uniqueBuilds.push_back(i);
+    }
+
+    std::vector<int> buildResults(targetsCount, OclocErrorCode::SUCCESS);
+    std::atomic<size_t> nextBuild{0u};
+    auto buildWorker = [&]() {
+        for (auto buildId = nextBuild++; buildId < uniqueBuilds.size(); buildId = nextBuild++) {
+            auto targetId = uniqueBuilds[buildId];
+            buildResults[targetId] = compilers[targetId]->build();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    const auto workersCount = std::min(jobs, uniqueBuilds.size());
+    for (size_t i = 1; i < workersCount; i++) {
+        workers.emplace_back(buildWorker);
+    }
+    buildWorker();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // Logs and archive entries are emitted in target order to keep the output deterministic
+    for (size_t i = 0; i < targetsCount; i++) {
+        const auto buildIndex = buildIndices[i];
+        argsCopy[deviceArgIndex] = targetProducts[i].str();
+        auto retVal = appendFatBinaryTargetOutput(buildResults[buildIndex], argsCopy, pointerSize, fatbinary, compilers[buildIndex].get(), argHelper, targetProducts[i].str());
+        if (retVal) {
+            return retVal;
+        }
+    }
+    return OclocErrorCode::SUCCESS;
 }
 
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
@@ -263,6 +349,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    size_t jobs = 1u;
 
     std::vector<std::string> argsCopy(args);
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
@@ -288,6 +375,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             excludeIr = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            jobs = getFatBinaryJobsCount(args[argIndex + 1]);
+            if (jobs == 0u) {
+                argHelper->printf("Error! Invalid number of jobs: %s\n", args[argIndex + 1].c_str());
+                return OclocErrorCode::INVALID_COMMAND_LINE;
+            }
+            ++argIndex;
         }
     }
 
@@ -308,19 +402,26 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
         return 1;
     }
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OclocErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+    if (jobs > 1 && targetProducts.size() > 1) {
+        auto retVal = buildFatBinaryForTargetsInParallel(argsCopy, deviceArgIndex, targetProducts, jobs, pointerSizeInBits, fatbinary, argHelper);
+        if (retVal) {
             return retVal;
         }
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
 
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
-        if (retVal) {
-            return retVal;
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
         }
     }
 
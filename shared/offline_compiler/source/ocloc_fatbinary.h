@@ -39,6 +39,12 @@ void getProductsAcronymsForTarget(std::vector<NEO::ConstStringRef> &out, Target
 std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+int appendFatBinaryTargetOutput(int buildRetVal, const std::vector<std::string> &argsCopy, const std::string &pointerSize, Ar::ArEncoder &fatbinary,
+                                OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product);
+int buildFatBinaryForTargetsInParallel(std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts, size_t jobs,
+                                       const std::string &pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper);
+std::string getProductConfigForFatBinaryEntry(const std::string &product);
+size_t getFatBinaryJobsCount(const std::string &jobsArg);
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper);
 std::vector<uint8_t> createEncodedElfWithSpirv(const ArrayRef<const uint8_t> &spirv);
 
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+// ocloc does not carry CPU feature detection, so it always uses scalar classifier
+TextClassification (*TextClassifier::classify)(ConstStringRef text) = classifyTextScalar;
+
+} // namespace Yaml
+
+} // namespace NEO
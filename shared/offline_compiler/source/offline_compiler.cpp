@@ -8,6 +8,7 @@
 #include "offline_compiler.h"
 
 #include "shared/offline_compiler/source/ocloc_error_code.h"
+#include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/offline_compiler/source/queries.h"
 #include "shared/offline_compiler/source/utilities/get_git_version_info.h"
 #include "shared/source/compiler_interface/compiler_options.h"
@@ -703,6 +704,14 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
         } else if ("--format" == currArg) {
             formatToEnforce = argv[argIndex + 1];
             argIndex++;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // Number of concurrent jobs is used by fatbinary build, single target build only validates it
+            if (getFatBinaryJobsCount(argv[argIndex + 1]) == 0u) {
+                argHelper->printf("Error: Invalid number of jobs %s.\n", argv[argIndex + 1].c_str());
+                retVal = INVALID_COMMAND_LINE;
+                break;
+            }
+            argIndex++;
         } else if (("-config" == currArg) && hasMoreArgs) {
             parseHwInfoConfigString(argv[argIndex + 1], hwInfoConfig);
             if (!hwInfoConfig) {
@@ -851,7 +860,7 @@ void OfflineCompiler::printUsage() {
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
-Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
+Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [-j <jobs>] [--help]
 
   -file <filename>              The input file to be compiled
                                 (by default input source format is
@@ -987,6 +996,12 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
   -config                       Target hardware info config for a single device,
                                 e.g 1x4x8.
 
+  -j <jobs>                     Number of target devices compiled concurrently
+                                when multiple target devices are provided,
+                                must be a positive number.
+                                For a single target device it has no effect.
+                                Default is 1.
+
 Examples :
   Compile file to Intel Compute GPU device binary (out = source_file_Gen9core.bin)
     ocloc -file source_file.cl -device skl
@@ -8,13 +8,19 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
-}
+class Thread;
+} // namespace NEO
 
 namespace AubMemDump {
 #include "aub_services.h"
@@ -120,6 +126,11 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    static constexpr size_t defaultWriterBufferSize = 8 * 1024 * 1024;
+
+    AubFileStream();
+    ~AubFileStream() override;
+
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -130,7 +141,7 @@ struct AubFileStream : public AubStream {
     void writeGTT(uint32_t offset, uint64_t entry) override;
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
-    MOCKABLE_VIRTUAL bool isOpen() const { return fileHandle.is_open(); }
+    MOCKABLE_VIRTUAL bool isOpen() const { return fileOpen.load(); }
     MOCKABLE_VIRTUAL const std::string &getFileName() const { return fileName; }
     MOCKABLE_VIRTUAL void write(const char *data, size_t size);
     MOCKABLE_VIRTUAL void flush();
@@ -143,6 +154,40 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    struct PendingBuffer {
+        std::vector<char> data;
+        bool flushFile = false;
+    };
+    static constexpr size_t maxPendingBuffers = 2;
+
+    static void *writerThreadFunc(void *self);
+    void processWrites();
+    void submitActiveBuffer(bool flushFile);
+    void waitForWriterIdle();
+    void startWriter();
+    void stopWriter();
+    MOCKABLE_VIRTUAL void writeToFile(const char *data, size_t size, bool flushFile);
+    void drainWriter();
+    static void drainOpenStreams();
+
+    // fileHandle is used by background writer, so its state is not queried from other threads
+    std::atomic<bool> fileOpen{false};
+
+    // Records are gathered in active buffer and queued for background thread that writes them to file in submission order.
+    // Only full buffers wait for the queue to drain, so flush never blocks the submitting thread.
+    std::unique_ptr<NEO::Thread> writerThread;
+    std::vector<char> activeBuffer;
+    std::deque<PendingBuffer> pendingBuffers;
+    std::vector<std::vector<char>> freeBuffers;
+    size_t pendingBytes = 0;
+    size_t buffersInFlight = 0;
+    size_t writerBufferSize = 0;
+    std::mutex writerMutex;
+    std::condition_variable writerCondition;
+    bool writerStopRequested = false;
+    bool synchronousFlush = false;
 };
 
 template <int addressingBits>
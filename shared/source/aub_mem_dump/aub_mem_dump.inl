@@ -7,6 +7,7 @@
 
 #include "shared/source/aub/aub_helper.h"
 #include "shared/source/aub_mem_dump/aub_mem_dump.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -122,9 +123,10 @@ void AubDump<Traits>::reserveAddressGGTTAndWriteMmeory(typename Traits::Stream &
                                                        size_t size, size_t offset,
                                                        uint64_t additionalBits, const NEO::AubHelper &aubHelper) {
     auto vmAddr = (gfxAddress + offset) & ~(MemoryConstants::pageSize - 1);
+    auto vmSize = alignUp(gfxAddress + offset + size, MemoryConstants::pageSize) - vmAddr;
     auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
 
-    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelper);
+    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, vmSize, pAddr, additionalBits, aubHelper);
 
     int hint = NEO::AubHelper::getMemTrace(additionalBits);
 
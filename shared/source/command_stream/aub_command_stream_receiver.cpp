@@ -7,14 +7,17 @@
 
 #include "shared/source/command_stream/aub_command_stream_receiver.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/abort.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 
 #include <algorithm>
@@ -89,24 +92,185 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::AubFileStream() = default;
+
+AubFileStream::~AubFileStream() {
+    stopWriter();
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+    fileOpen = fileHandle.is_open();
+    if (fileOpen) {
+        startWriter();
+    }
 }
 
 void AubFileStream::close() {
+    stopWriter();
     fileHandle.close();
+    fileOpen = false;
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
-    fileHandle.write(data, size);
+    if (!writerThread) {
+        fileHandle.write(data, size);
+        return;
+    }
+
+    while (size > 0) {
+        auto sizeThisIteration = std::min(size, writerBufferSize - activeBuffer.size());
+        activeBuffer.insert(activeBuffer.end(), data, data + sizeThisIteration);
+        if (activeBuffer.size() == writerBufferSize) {
+            submitActiveBuffer(false);
+        }
+        data += sizeThisIteration;
+        size -= sizeThisIteration;
+    }
 }
 
 void AubFileStream::flush() {
+    if (writerThread) {
+        // writer flushes the file once all records submitted so far are written
+        submitActiveBuffer(true);
+        if (synchronousFlush) {
+            waitForWriterIdle();
+        }
+        return;
+    }
     fileHandle.flush();
 }
 
+static std::mutex &getOpenStreamsMutex() {
+    static std::mutex openStreamsMutex;
+    return openStreamsMutex;
+}
+
+static std::vector<AubFileStream *> &getOpenStreams() {
+    static std::vector<AubFileStream *> openStreams;
+    return openStreams;
+}
+
+void AubFileStream::startWriter() {
+    auto bufferSize = NEO::DebugManager.flags.AUBDumpFileWriterBufferSize.get();
+    if (bufferSize == 0 || writerThread) {
+        return;
+    }
+    writerBufferSize = (bufferSize > 0) ? static_cast<size_t>(bufferSize) : defaultWriterBufferSize;
+    synchronousFlush = NEO::DebugManager.flags.AUBDumpFileWriterSynchronousFlush.get() == 1;
+    activeBuffer.reserve(writerBufferSize);
+    writerStopRequested = false;
+    pendingBytes = 0;
+    buffersInFlight = 0;
+    writerThread = NEO::Thread::create(writerThreadFunc, reinterpret_cast<void *>(this));
+
+    // records still buffered when driver aborts are written out, they usually show what led to the abort
+    std::lock_guard<std::mutex> lock(getOpenStreamsMutex());
+    getOpenStreams().push_back(this);
+    NEO::setAbortExecutionHandler(drainOpenStreams);
+}
+
+void AubFileStream::stopWriter() {
+    if (!writerThread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(getOpenStreamsMutex());
+        auto &openStreams = getOpenStreams();
+        openStreams.erase(std::remove(openStreams.begin(), openStreams.end(), this), openStreams.end());
+    }
+    if (!activeBuffer.empty()) {
+        submitActiveBuffer(false);
+    }
+    {
+        std::unique_lock<std::mutex> lock(writerMutex);
+        writerStopRequested = true;
+    }
+    writerCondition.notify_all();
+    writerThread->join();
+    writerThread.reset();
+
+    std::vector<char>().swap(activeBuffer);
+    std::vector<std::vector<char>>().swap(freeBuffers);
+}
+
+void AubFileStream::submitActiveBuffer(bool flushFile) {
+    {
+        std::unique_lock<std::mutex> lock(writerMutex);
+        if (!flushFile) {
+            writerCondition.wait(lock, [this] { return pendingBytes < maxPendingBuffers * writerBufferSize; });
+        }
+        pendingBytes += activeBuffer.size();
+        buffersInFlight++;
+        pendingBuffers.push_back({std::move(activeBuffer), flushFile});
+        activeBuffer.clear();
+        if (!freeBuffers.empty()) {
+            activeBuffer.swap(freeBuffers.back());
+            freeBuffers.pop_back();
+        }
+    }
+    writerCondition.notify_all();
+    activeBuffer.reserve(writerBufferSize);
+}
+
+void AubFileStream::waitForWriterIdle() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return buffersInFlight == 0; });
+}
+
+void AubFileStream::drainWriter() {
+    if (writerThread) {
+        submitActiveBuffer(true);
+        waitForWriterIdle();
+    }
+}
+
+void AubFileStream::drainOpenStreams() {
+    std::lock_guard<std::mutex> lock(getOpenStreamsMutex());
+    for (auto stream : getOpenStreams()) {
+        stream->drainWriter();
+    }
+}
+
+void AubFileStream::writeToFile(const char *data, size_t size, bool flushFile) {
+    fileHandle.write(data, size);
+    if (flushFile) {
+        fileHandle.flush();
+    }
+}
+
+void *AubFileStream::writerThreadFunc(void *self) {
+    reinterpret_cast<AubFileStream *>(self)->processWrites();
+    return nullptr;
+}
+
+void AubFileStream::processWrites() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true) {
+        writerCondition.wait(lock, [this] { return !pendingBuffers.empty() || writerStopRequested; });
+        if (pendingBuffers.empty()) {
+            return;
+        }
+
+        // queued buffer is owned by writer thread, so file can be written without holding the lock
+        auto buffer = std::move(pendingBuffers.front());
+        pendingBuffers.pop_front();
+        lock.unlock();
+        writeToFile(buffer.data.data(), buffer.data.size(), buffer.flushFile);
+        lock.lock();
+
+        pendingBytes -= buffer.data.size();
+        buffersInFlight--;
+        if (freeBuffers.size() < maxPendingBuffers) {
+            buffer.data.clear();
+            freeBuffers.push_back(std::move(buffer.data));
+        }
+        writerCondition.notify_all();
+    }
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -33,6 +33,9 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     using BaseClass::osContext;
 
   public:
+    // Upper bound for single PPGTT reservation and memory write created from physically contiguous pages
+    static constexpr size_t maxCoalescedWriteSize = static_cast<size_t>(16 * MemoryConstants::megaByte);
+
     using BaseClass::peekExecutionEnvironment;
     using CommandStreamReceiverSimulatedCommonHw<GfxFamily>::initAdditionalMMIO;
     using CommandStreamReceiverSimulatedCommonHw<GfxFamily>::aubManager;
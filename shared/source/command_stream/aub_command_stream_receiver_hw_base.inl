@@ -641,12 +641,18 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
 
-    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+    PageWalker rangeWriter = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
+    CoalescingPageWalker coalescingWalker(rangeWriter, maxCoalescedWriteSize);
+
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        coalescingWalker.addPage(physAddress, size, offset, entryBits);
+    };
 
     ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
+    coalescingWalker.flush();
 }
 
 template <typename GfxFamily>
@@ -665,12 +671,19 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
+    auto writableRanges = gfxAllocation.isCompressionEnabled() ? nullptr : this->getAubWritableRanges(gfxAllocation);
+    bool writeRangesOnly = (writableRanges != nullptr);
+
     auto streamLocked = getAubStream()->lockStream();
 
-    if (aubManager) {
+    if (writeRangesOnly) {
+        this->addDumpedBytes(this->writeMemoryRanges(gfxAllocation, gpuAddress, cpuAddress, size, *writableRanges));
+    } else if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
+        this->addDumpedBytes(size);
     } else {
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        this->addDumpedBytes(size);
     }
 
     streamLocked.unlock();
@@ -679,7 +692,7 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         this->getMemoryManager()->unlockResource(&gfxAllocation);
     }
 
-    if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
+    if (writeRangesOnly || AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
         this->setAubWritable(false, gfxAllocation);
     }
 
@@ -737,6 +750,8 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::expectMemory(const void *gfxAddress,
 
 template <typename GfxFamily>
 bool AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) {
+    this->dumpedBytesInLastFlush = 0u;
+
     if (subCaptureManager->isSubCaptureMode()) {
         if (!subCaptureManager->isSubCaptureEnabled()) {
             return true;
@@ -760,6 +775,9 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintAubTbxDumpedBytes.get(), stdout,
+                       "AUB flush dumped %zu bytes, %llu bytes in total\n", this->dumpedBytesInLastFlush, static_cast<unsigned long long>(this->totalDumpedBytes));
+
     dumpAubNonWritable = false;
     return true;
 }
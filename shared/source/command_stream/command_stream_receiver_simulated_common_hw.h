@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_banks.h"
 
 #include "aub_mapper.h"
@@ -29,6 +30,7 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     using MiContextDescriptorReg = typename AUB::MiContextDescriptorReg;
 
     bool getParametersForWriteMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const;
+    void addDumpedBytes(size_t size);
     void freeEngineInfo(AddressMapper &gttRemap);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
 
@@ -64,6 +66,11 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     virtual bool isAubWritable(GraphicsAllocation &graphicsAllocation) const = 0;
     virtual void setTbxWritable(bool writable, GraphicsAllocation &graphicsAllocation) = 0;
     virtual bool isTbxWritable(GraphicsAllocation &graphicsAllocation) const = 0;
+    virtual const AubInfo::WritableRanges *getAubWritableRanges(GraphicsAllocation &graphicsAllocation) const = 0;
+    virtual const AubInfo::WritableRanges *getTbxWritableRanges(GraphicsAllocation &graphicsAllocation) const = 0;
+
+    size_t getDumpedBytesInLastFlush() const { return dumpedBytesInLastFlush; }
+    uint64_t getTotalDumpedBytes() const { return totalDumpedBytes; }
 
     virtual void dumpAllocation(GraphicsAllocation &gfxAllocation) = 0;
     virtual void initializeEngine() = 0;
@@ -87,5 +94,9 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     } engineInfo = {};
 
     AubMemDump::AubStream *stream;
+
+  protected:
+    size_t dumpedBytesInLastFlush = 0u;
+    uint64_t totalDumpedBytes = 0u;
 };
 } // namespace NEO
@@ -63,6 +63,12 @@ bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getParametersForWriteMem
     return true;
 }
 
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::addDumpedBytes(size_t size) {
+    dumpedBytesInLastFlush += size;
+    totalDumpedBytes += size;
+}
+
 template <typename GfxFamily>
 bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::expectMemoryEqual(void *gfxAddress, const void *srcAddress, size_t length) {
     return this->expectMemory(gfxAddress, srcAddress, length,
@@ -10,6 +10,7 @@
 #include "shared/source/aub_mem_dump/aub_mem_dump.h"
 #include "shared/source/command_stream/command_stream_receiver_simulated_common_hw.h"
 #include "shared/source/gmm_helper/cache_settings_helper.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hardware_context_controller.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -23,6 +24,8 @@
 #include "third_party/aub_stream/headers/aub_manager.h"
 #include "third_party/aub_stream/headers/hardware_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 class GraphicsAllocation;
 template <typename GfxFamily>
@@ -101,6 +104,10 @@ class CommandStreamReceiverSimulatedHw : public CommandStreamReceiverSimulatedCo
         void *cpuAddress;
         size_t size;
         this->getParametersForWriteMemory(graphicsAllocation, gpuAddress, cpuAddress, size);
+        writeMemoryRangeWithAubManager(graphicsAllocation, gpuAddress, cpuAddress, size);
+    }
+
+    void writeMemoryRangeWithAubManager(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size) {
         int hint = graphicsAllocation.getAllocationType() == AllocationType::COMMAND_BUFFER
                        ? AubMemDump::DataTypeHintValues::TraceBatchBuffer
                        : AubMemDump::DataTypeHintValues::TraceNotype;
@@ -122,6 +129,31 @@ class CommandStreamReceiverSimulatedHw : public CommandStreamReceiverSimulatedCo
         }
     }
 
+    size_t writeMemoryRanges(GraphicsAllocation &graphicsAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size, const AubInfo::WritableRanges &ranges) {
+        size_t pageSize = graphicsAllocation.getUsedPageSize();
+        size_t writtenEnd = 0u;
+        size_t writtenSize = 0u;
+        for (auto &range : ranges) {
+            auto rangeStart = std::max(alignDown(range.first, pageSize), writtenEnd);
+            auto rangeEnd = std::min(alignUp(range.first + range.second, pageSize), size);
+            if (rangeStart >= size) {
+                break;
+            }
+            if (rangeStart >= rangeEnd) {
+                continue;
+            }
+            if (aubManager) {
+                writeMemoryRangeWithAubManager(graphicsAllocation, gpuAddress + rangeStart, ptrOffset(cpuAddress, rangeStart), rangeEnd - rangeStart);
+            } else {
+                this->writeMemory(gpuAddress + rangeStart, ptrOffset(cpuAddress, rangeStart), rangeEnd - rangeStart,
+                                  getMemoryBank(&graphicsAllocation), this->getPPGTTAdditionalBits(&graphicsAllocation));
+            }
+            writtenEnd = rangeEnd;
+            writtenSize += rangeEnd - rangeStart;
+        }
+        return writtenSize;
+    }
+
     void setAubWritable(bool writable, GraphicsAllocation &graphicsAllocation) override {
         auto bank = getMemoryBank(&graphicsAllocation);
         if (bank == 0u || graphicsAllocation.storageInfo.cloningOfPageTables) {
@@ -154,5 +186,21 @@ class CommandStreamReceiverSimulatedHw : public CommandStreamReceiverSimulatedCo
         }
         return graphicsAllocation.isTbxWritable(bank);
     }
+
+    const AubInfo::WritableRanges *getAubWritableRanges(GraphicsAllocation &graphicsAllocation) const override {
+        auto bank = getMemoryBank(&graphicsAllocation);
+        if (bank == 0u || graphicsAllocation.storageInfo.cloningOfPageTables) {
+            bank = GraphicsAllocation::defaultBank;
+        }
+        return graphicsAllocation.getAubWritableRanges(bank);
+    }
+
+    const AubInfo::WritableRanges *getTbxWritableRanges(GraphicsAllocation &graphicsAllocation) const override {
+        auto bank = getMemoryBank(&graphicsAllocation);
+        if (bank == 0u || graphicsAllocation.storageInfo.cloningOfPageTables) {
+            bank = GraphicsAllocation::defaultBank;
+        }
+        return graphicsAllocation.getTbxWritableRanges(bank);
+    }
 };
 } // namespace NEO
@@ -439,13 +439,20 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
         return false;
     }
 
-    if (aubManager) {
+    auto writableRanges = gfxAllocation.isCompressionEnabled() ? nullptr : this->getTbxWritableRanges(gfxAllocation);
+    bool writeRangesOnly = (writableRanges != nullptr);
+
+    if (writeRangesOnly) {
+        this->addDumpedBytes(this->writeMemoryRanges(gfxAllocation, gpuAddress, cpuAddress, size, *writableRanges));
+    } else if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
+        this->addDumpedBytes(size);
     } else {
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        this->addDumpedBytes(size);
     }
 
-    if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
+    if (writeRangesOnly || AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
         this->setTbxWritable(false, gfxAllocation);
     }
 
@@ -517,6 +524,8 @@ void TbxCommandStreamReceiverHw<GfxFamily>::processEviction() {
 
 template <typename GfxFamily>
 bool TbxCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) {
+    this->dumpedBytesInLastFlush = 0u;
+
     for (auto &gfxAllocation : allocationsForResidency) {
         if (dumpTbxNonWritable) {
             this->setTbxWritable(true, *gfxAllocation);
@@ -528,6 +537,9 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintAubTbxDumpedBytes.get(), stdout,
+                       "TBX flush dumped %zu bytes, %llu bytes in total\n", this->dumpedBytesInLastFlush, static_cast<unsigned long long>(this->totalDumpedBytes));
+
     dumpTbxNonWritable = false;
     return true;
 }
@@ -10,26 +10,39 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
-#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/stdio.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
+#include <functional>
 #include <iomanip>
 #include <mutex>
+#include <new>
 #include <sstream>
 #include <string>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+std::array<std::mutex, CompilerCache::entryMutexCount> CompilerCache::entryMutexes;
+std::atomic<uint32_t> CompilerCache::tempFileCounter{0u};
+
+std::mutex &CompilerCache::getEntryMutex(const std::string &kernelFileHash) {
+    return entryMutexes[std::hash<std::string>{}(kernelFileHash) % entryMutexCount];
+}
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> specConstants) {
+    Hash128 hash;
 
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
@@ -41,24 +54,31 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update(safePodCast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
     hash.update("----", 4);
 
-    const auto featureTableHashStr = std::to_string(hwInfo.featureTable.asHash());
-    hash.update(featureTableHashStr.c_str(), featureTableHashStr.length());
+    const auto featureTableHash = hwInfo.featureTable.asHash();
+    hash.update(reinterpret_cast<const char *>(&featureTableHash), sizeof(featureTableHash));
     hash.update("----", 4);
 
-    const auto workaroundTableHashStr = std::to_string(hwInfo.workaroundTable.asHash());
-    hash.update(workaroundTableHashStr.c_str(), workaroundTableHashStr.length());
+    const auto workaroundTableHash = hwInfo.workaroundTable.asHash();
+    hash.update(reinterpret_cast<const char *>(&workaroundTableHash), sizeof(workaroundTableHash));
+
+    if (false == specConstants.empty()) {
+        hash.update("----", 4);
+        hash.update(&*specConstants.begin(), specConstants.size());
+    }
 
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
 
     if (DebugManager.flags.BinaryCacheTrace.get()) {
         std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
         std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".input";
-        std::lock_guard<std::mutex> lock(cacheAccessMtx);
+        std::lock_guard<std::mutex> lock(getEntryMutex(stream.str()));
         auto fp = NEO::IoFunctions::fopenPtr(traceFilePath.c_str(), "w");
         if (fp) {
             NEO::IoFunctions::fprintf(fp, "---- input ----\n");
@@ -94,6 +114,14 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
             }
             NEO::IoFunctions::fprintf(fp, "\n");
 
+            if (false == specConstants.empty()) {
+                NEO::IoFunctions::fprintf(fp, "---- specialization constants ----\n");
+                for (size_t idx = 0; idx < specConstants.size(); idx++) {
+                    NEO::IoFunctions::fprintf(fp, "%02x.", static_cast<uint8_t>(specConstants[idx]));
+                }
+                NEO::IoFunctions::fprintf(fp, "\n");
+            }
+
             NEO::IoFunctions::fclosePtr(fp);
         }
         fp = NEO::IoFunctions::fopenPtr(inputFilePath.c_str(), "w");
@@ -107,22 +135,276 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (DebugManager.flags.BinaryCacheMmapThreshold.get() != -1) {
+        config.mmapThreshold = static_cast<size_t>(DebugManager.flags.BinaryCacheMmapThreshold.get());
+    }
+    if (DebugManager.flags.BinaryCacheMemoryTierSize.get() != -1) {
+        config.memoryTierSize = static_cast<size_t>(DebugManager.flags.BinaryCacheMemoryTierSize.get());
+    }
+    if (config.memoryTierSize != 0u) {
+        memoryTier = std::make_unique<CompilerCacheMemoryTier>(config.memoryTierSize);
+    }
+}
+
+CompilerCache::~CompilerCache() {
+    if (memoryTier && DebugManager.flags.PrintBinaryCacheStatistics.get()) {
+        auto statistics = memoryTier->getStatistics();
+        printf("Compiler cache memory tier: hits: %llu, misses: %llu, bytes served: %llu, bytes stored: %llu, evictions: %llu, current size: %zu / %zu\n",
+               static_cast<unsigned long long>(statistics.hits), static_cast<unsigned long long>(statistics.misses),
+               static_cast<unsigned long long>(statistics.bytesServed), static_cast<unsigned long long>(statistics.bytesStored),
+               static_cast<unsigned long long>(statistics.evictions), statistics.currentSize, memoryTier->getMaxSize());
+    }
+}
+
+uint64_t CompilerCache::computeChecksum(const char *pBinary, size_t binarySize) {
+    auto checksum = Hash128::hash(pBinary, binarySize);
+    return checksum.low ^ checksum.high;
+}
+
+std::string CompilerCache::getFilePath(const std::string &kernelFileHash) const {
+    return config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+}
+
+std::string CompilerCache::getTempFilePath(const std::string &filePath) {
+    std::stringstream stream;
+    stream << filePath << ".tmp." << SysCalls::getProcessId() << "." << tempFileCounter++;
+    return stream.str();
+}
+
+bool CompilerCache::isCacheEntryFileName(const char *fileName) const {
+    // temp files of in-flight stores contain the extension too, so only the exact suffix counts
+    const auto &extension = config.cacheFileExtension;
+    auto nameLength = strlen(fileName);
+    return fileName[0] != '.' &&
+           nameLength > extension.size() &&
+           0 == strcmp(fileName + nameLength - extension.size(), extension.c_str());
+}
+
+bool CompilerCache::isCacheTempFileName(const char *fileName) const {
+    // see getTempFilePath
+    auto tempFileInfix = config.cacheFileExtension + ".tmp.";
+    return fileName[0] != '.' && nullptr != strstr(fileName, tempFileInfix.c_str());
+}
+
+size_t CompilerCache::getFileSize(const std::string &filePath) {
+    FILE *fp = nullptr;
+    fopen_s(&fp, filePath.c_str(), "rb");
+    if (fp == nullptr) {
+        return 0u;
+    }
+    fseek(fp, 0, SEEK_END);
+    auto fileSize = static_cast<size_t>(ftell(fp));
+    fclose(fp);
+    return fileSize;
+}
+
+bool CompilerCache::writeCacheEntry(const std::string &filePath, const char *pBinary, size_t binarySize) {
+    CompilerCacheEntryHeader header;
+    header.binarySize = binarySize;
+    header.checksum = computeChecksum(pBinary, binarySize);
+
+    FILE *fp = nullptr;
+    fopen_s(&fp, filePath.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    size_t written = fwrite(&header, 1, sizeof(header), fp);
+    written += fwrite(pBinary, 1, binarySize, fp);
+    bool closed = (0 == fclose(fp));
+
+    return closed && (written == sizeof(header) + binarySize);
+}
+
+bool CompilerCache::isValidCacheEntryHeader(const CompilerCacheEntryHeader &header, size_t fileSize) {
+    return header.headerMagic == CompilerCacheEntryHeader::magic &&
+           header.version == CompilerCacheEntryHeader::currentVersion &&
+           header.binarySize != 0u &&
+           header.binarySize == fileSize - sizeof(header);
+}
+
+std::unique_ptr<char[]> CompilerCache::readCacheEntry(const std::string &filePath, size_t &binarySize, bool &isCorrupted) {
+    binarySize = 0u;
+    isCorrupted = false;
+
+    FILE *fp = nullptr;
+    fopen_s(&fp, filePath.c_str(), "rb");
+    if (fp == nullptr) {
+        return nullptr;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    auto fileSize = static_cast<size_t>(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+
+    CompilerCacheEntryHeader header;
+    std::unique_ptr<char[]> binary;
+    isCorrupted = true;
+    if (fileSize >= sizeof(header) && sizeof(header) == fread(&header, 1, sizeof(header), fp)) {
+        if (isValidCacheEntryHeader(header, fileSize)) {
+            auto size = static_cast<size_t>(header.binarySize);
+            binary.reset(new (std::nothrow) char[size]);
+            if (binary && size == fread(binary.get(), 1, size, fp) && header.checksum == computeChecksum(binary.get(), size)) {
+                binarySize = size;
+                isCorrupted = false;
+            }
+        }
+    }
+    fclose(fp);
+
+    if (isCorrupted) {
+        binary.reset();
+    }
+    return binary;
+}
+
+bool CompilerCache::removeCacheEntry(const std::string &filePath) {
+    return 0 == std::remove(filePath.c_str());
+}
+
+bool CompilerCache::evictCache(size_t bytesNeeded) {
+    std::lock_guard<std::mutex> lock(evictionMtx);
+    if (cacheSizeKnown && knownCacheSize + bytesNeeded <= config.cacheSize) {
+        return true;
+    }
+
+    // Other processes may share the directory, so the real size is taken from disk
+    // whenever the size tracked by this process would exceed the budget.
+    auto entries = getCacheEntries();
+    size_t totalSize = 0u;
+    for (const auto &entry : entries) {
+        totalSize += entry.size;
+    }
+
+    // Temp files are never published, so stale ones (left behind by crashed writers) are removed.
+    // Temp files of in-flight stores count against the budget, but are not evicted.
+    for (const auto &entry : entries) {
+        if (entry.isStaleTempFile && removeCacheEntry(entry.path)) {
+            totalSize -= entry.size;
+        }
+    }
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const CacheEntryInfo &entry) { return entry.isTempFile; }), entries.end());
+
+    if (totalSize + bytesNeeded > config.cacheSize) {
+        // evict down to 3/4 of the budget to amortize directory scans over several stores
+        auto sizeLimit = std::max(config.cacheSize - config.cacheSize / 4, bytesNeeded);
+        std::sort(entries.begin(), entries.end(), [](const CacheEntryInfo &lhs, const CacheEntryInfo &rhs) {
+            return lhs.lastAccessTime < rhs.lastAccessTime;
+        });
+        for (const auto &entry : entries) {
+            if (totalSize + bytesNeeded <= sizeLimit) {
+                break;
+            }
+            if (removeCacheEntry(entry.path)) {
+                totalSize -= entry.size;
+            }
+        }
+    }
+
+    knownCacheSize = totalSize;
+    cacheSizeKnown = true;
+    return totalSize + bytesNeeded <= config.cacheSize;
+}
 
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+    bool storedInMemory = false;
+    if (memoryTier && binarySize <= memoryTier->getMaxSize()) {
+        std::shared_ptr<char[]> binary(new (std::nothrow) char[binarySize]);
+        if (binary) {
+            memcpy_s(binary.get(), binarySize, pBinary, binarySize);
+            memoryTier->store(kernelFileHash, std::move(binary), binarySize);
+            storedInMemory = true;
+        }
+    }
+
+    const size_t entrySize = sizeof(CompilerCacheEntryHeader) + binarySize;
+    if (config.cacheSize != 0u && entrySize > config.cacheSize) {
+        return storedInMemory;
+    }
+
+    if (config.cacheSize != 0u && false == evictCache(entrySize)) {
+        return storedInMemory;
+    }
+
+    // entry is published with rename, so readers never observe a partially written file
+    // and only concurrent stores of the same entry need to be serialized
+    std::string filePath = getFilePath(kernelFileHash);
+    std::lock_guard<std::mutex> lock(getEntryMutex(kernelFileHash));
+    std::string tempFilePath = getTempFilePath(filePath);
+    if (false == writeCacheEntry(tempFilePath, pBinary, binarySize)) {
+        removeCacheEntry(tempFilePath);
+        return storedInMemory;
+    }
+    auto replacedEntrySize = getFileSize(filePath);
+    if (false == renameTempFileToProperName(tempFilePath, filePath)) {
+        removeCacheEntry(tempFilePath);
+        return storedInMemory;
+    }
+
+    knownCacheSize += entrySize;
+    knownCacheSize -= replacedEntrySize;
+    return true;
+}
+
+void CompilerCache::removeCorruptedCacheEntry(const std::string &kernelFileHash, const std::string &filePath) {
+    // a concurrent store may have replaced the entry since it was read, so it is
+    // checked again under the entry lock and removed only if it is still corrupted
+    std::lock_guard<std::mutex> lock(getEntryMutex(kernelFileHash));
+    size_t binarySize = 0u;
+    bool isCorrupted = false;
+    readCacheEntry(filePath, binarySize, isCorrupted);
+    if (isCorrupted) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "Removing corrupted compiler cache entry: %s\n", filePath.c_str());
+        removeCacheEntry(filePath);
+    }
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    std::string filePath = getFilePath(kernelFileHash);
+
+    bool isCorrupted = false;
+    auto binary = readCacheEntry(filePath, cachedBinarySize, isCorrupted);
+    if (isCorrupted) {
+        removeCorruptedCacheEntry(kernelFileHash, filePath);
+        return nullptr;
+    }
+    if (binary) {
+        markCacheEntryAccessed(filePath);
+    }
+    return binary;
 }
 
-std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+CompilerCacheMemoryTier::BinaryT CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
+    if (memoryTier) {
+        auto binary = memoryTier->load(kernelFileHash, cachedBinarySize);
+        if (binary) {
+            return binary;
+        }
+    }
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    CompilerCacheMemoryTier::BinaryT binary;
+    if (config.mmapThreshold != 0u) {
+        std::string filePath = getFilePath(kernelFileHash);
+        bool isCorrupted = false;
+        binary = mapCacheEntry(filePath, config.mmapThreshold, cachedBinarySize, isCorrupted);
+        if (isCorrupted) {
+            removeCorruptedCacheEntry(kernelFileHash, filePath);
+            return nullptr;
+        }
+        if (binary) {
+            markCacheEntryAccessed(filePath);
+        }
+    }
+    if (binary == nullptr) {
+        binary = loadCachedBinaryFromDisk(kernelFileHash, cachedBinarySize);
+    }
+    if (binary && memoryTier) {
+        memoryTier->store(kernelFileHash, binary, cachedBinarySize);
+    }
+    return binary;
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,27 +7,60 @@
 
 #pragma once
 
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
 
 struct CompilerCacheConfig {
+    static constexpr size_t defaultCacheSize = 1024u * 1024u * 1024u;
+    static constexpr size_t defaultMemoryTierSize = 64u * 1024u * 1024u;
+    static constexpr size_t defaultMmapThreshold = 64u * 1024u;
+
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    size_t cacheSize = 0u;      // 0 - no limit
+    size_t memoryTierSize = 0u; // 0 - in-process tier disabled
+    size_t mmapThreshold = 0u;  // 0 - entries are always read into memory
+};
+
+struct CompilerCacheEntryHeader {
+    static constexpr uint32_t magic = 0x434f454e; // "NEOC"
+    static constexpr uint32_t currentVersion = 2u;
+
+    uint32_t headerMagic = magic;
+    uint32_t version = currentVersion;
+    uint64_t binarySize = 0u;
+    uint64_t checksum = 0u;
 };
+static_assert(sizeof(CompilerCacheEntryHeader) == 24u, "Cache entry header is part of on-disk format");
 
 class CompilerCache {
   public:
+    struct CacheEntryInfo {
+        std::string path;
+        size_t size = 0u;
+        uint64_t lastAccessTime = 0u;
+        bool isTempFile = false;      // written by an in-flight store or left behind by a crashed writer
+        bool isStaleTempFile = false; // temp file not modified for staleTempFileAgeInSeconds
+    };
+
+    static constexpr uint64_t staleTempFileAgeInSeconds = 10 * 60;
+
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -35,13 +68,56 @@ class CompilerCache {
     CompilerCache &operator=(CompilerCache &&) = delete;
 
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
-                                        ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+                                        ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                        ArrayRef<const char> specConstants = {});
 
+    // Returns true if the next lookup of kernelFileHash can be served, either from the memory tier or from disk.
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
-    MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+    // Returned binary can be shared with the memory tier or be a read-only mapping of the entry, it is not copied on a hit.
+    MOCKABLE_VIRTUAL CompilerCacheMemoryTier::BinaryT loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+
+    CompilerCacheMemoryTier *getMemoryTier() const { return memoryTier.get(); }
+
+    static uint64_t computeChecksum(const char *pBinary, size_t binarySize);
 
   protected:
-    static std::mutex cacheAccessMtx;
+    std::string getFilePath(const std::string &kernelFileHash) const;
+    std::string getTempFilePath(const std::string &filePath);
+    bool isCacheEntryFileName(const char *fileName) const;
+    bool isCacheTempFileName(const char *fileName) const;
+    static size_t getFileSize(const std::string &filePath);
+    static bool isValidCacheEntryHeader(const CompilerCacheEntryHeader &header, size_t fileSize);
+    bool writeCacheEntry(const std::string &filePath, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> readCacheEntry(const std::string &filePath, size_t &binarySize, bool &isCorrupted);
+    std::unique_ptr<char[]> loadCachedBinaryFromDisk(const std::string &kernelFileHash, size_t &cachedBinarySize);
+    void removeCorruptedCacheEntry(const std::string &kernelFileHash, const std::string &filePath);
+
+    MOCKABLE_VIRTUAL bool evictCache(size_t bytesNeeded);
+    MOCKABLE_VIRTUAL bool removeCacheEntry(const std::string &filePath);
+
+    // OS specific
+    MOCKABLE_VIRTUAL std::vector<CacheEntryInfo> getCacheEntries();
+    MOCKABLE_VIRTUAL bool renameTempFileToProperName(const std::string &tempFilePath, const std::string &filePath);
+    MOCKABLE_VIRTUAL void markCacheEntryAccessed(const std::string &filePath);
+    // Maps entries of at least minFileSize as read-only and validates them like readCacheEntry, but
+    // without copying them to the heap. Entries are published with rename and never modified in place,
+    // so the checksum of a given file is verified once per cache and later mappings check only the header.
+    MOCKABLE_VIRTUAL CompilerCacheMemoryTier::BinaryT mapCacheEntry(const std::string &filePath, size_t minFileSize, size_t &binarySize, bool &isCorrupted);
+
+    static std::mutex &getEntryMutex(const std::string &kernelFileHash);
+
+    static constexpr size_t entryMutexCount = 32u;
+    static std::array<std::mutex, entryMutexCount> entryMutexes;
+    static std::atomic<uint32_t> tempFileCounter;
+
     CompilerCacheConfig config;
+    std::unique_ptr<CompilerCacheMemoryTier> memoryTier;
+
+    std::mutex verifiedEntriesMtx;
+    std::unordered_set<std::string> verifiedEntries; // path and identity of files with verified checksum
+
+    std::mutex evictionMtx;
+    std::atomic<size_t> knownCacheSize{0u};
+    bool cacheSizeKnown = false;
 };
 } // namespace NEO
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+
+namespace NEO {
+
+CompilerCacheMemoryTier::BinaryT CompilerCacheMemoryTier::load(const std::string &kernelFileHash, size_t &binarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it == entriesByHash.end()) {
+        statistics.misses++;
+        binarySize = 0u;
+        return nullptr;
+    }
+
+    entries.splice(entries.begin(), entries, it->second);
+    statistics.hits++;
+    statistics.bytesServed += it->second->size;
+    binarySize = it->second->size;
+    return it->second->binary;
+}
+
+void CompilerCacheMemoryTier::store(const std::string &kernelFileHash, BinaryT binary, size_t binarySize) {
+    if (binary == nullptr || binarySize == 0u || binarySize > maxSize) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entriesByHash.find(kernelFileHash);
+    if (it != entriesByHash.end()) {
+        currentSize -= it->second->size;
+        entries.erase(it->second);
+        entriesByHash.erase(it);
+    }
+
+    evict(binarySize);
+
+    entries.push_front({kernelFileHash, std::move(binary), binarySize});
+    entriesByHash[kernelFileHash] = entries.begin();
+    currentSize += binarySize;
+    statistics.bytesStored += binarySize;
+}
+
+void CompilerCacheMemoryTier::evict(size_t bytesNeeded) {
+    while (false == entries.empty() && currentSize + bytesNeeded > maxSize) {
+        auto &leastRecentlyUsed = entries.back();
+        currentSize -= leastRecentlyUsed.size;
+        entriesByHash.erase(leastRecentlyUsed.kernelFileHash);
+        entries.pop_back();
+        statistics.evictions++;
+    }
+}
+
+CompilerCacheMemoryTier::Statistics CompilerCacheMemoryTier::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto ret = statistics;
+    ret.currentSize = currentSize;
+    return ret;
+}
+
+} // namespace NEO
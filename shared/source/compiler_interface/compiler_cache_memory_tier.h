@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+class CompilerCacheMemoryTier {
+  public:
+    using BinaryT = std::shared_ptr<const char[]>;
+
+    struct Statistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t bytesServed = 0u;
+        uint64_t bytesStored = 0u;
+        uint64_t evictions = 0u;
+        size_t currentSize = 0u;
+    };
+
+    CompilerCacheMemoryTier(size_t maxSize) : maxSize(maxSize) {}
+
+    BinaryT load(const std::string &kernelFileHash, size_t &binarySize);
+    void store(const std::string &kernelFileHash, BinaryT binary, size_t binarySize);
+    Statistics getStatistics();
+
+    size_t getMaxSize() const { return maxSize; }
+
+  protected:
+    struct Entry {
+        std::string kernelFileHash;
+        BinaryT binary;
+        size_t size;
+    };
+    using EntryListT = std::list<Entry>;
+
+    void evict(size_t bytesNeeded);
+
+    std::mutex mtx;
+    EntryListT entries; // front - most recently used
+    std::unordered_map<std::string, EntryListT::iterator> entriesByHash;
+    size_t currentSize = 0u;
+    const size_t maxSize;
+
+    Statistics statistics;
+};
+
+} // namespace NEO
@@ -11,6 +11,8 @@
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/zeinfo_blob.h"
 #include "shared/source/helpers/compiler_hw_info_config.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/os_inc_base.h"
@@ -23,6 +25,7 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 #include "ocl_igc_interface/platform_helper.h"
 
+#include <algorithm>
 #include <fstream>
 
 namespace NEO {
@@ -34,6 +37,23 @@ enum CachingMode {
     PreProcess
 };
 
+// Specialization constants are serialized in id order so that the cache key
+// does not depend on the iteration order of the map
+static std::vector<char> getSpecConstantsCacheKey(const specConstValuesMap &specializedValues) {
+    std::vector<std::pair<uint32_t, uint64_t>> sortedValues(specializedValues.begin(), specializedValues.end());
+    std::sort(sortedValues.begin(), sortedValues.end());
+
+    std::vector<char> key(sortedValues.size() * (sizeof(uint32_t) + sizeof(uint64_t)));
+    auto pKey = key.data();
+    for (const auto &specConst : sortedValues) {
+        memcpy_s(pKey, sizeof(uint32_t), &specConst.first, sizeof(uint32_t));
+        pKey += sizeof(uint32_t);
+        memcpy_s(pKey, sizeof(uint64_t), &specConst.second, sizeof(uint64_t));
+        pKey += sizeof(uint64_t);
+    }
+    return key;
+}
+
 CompilerInterface::CompilerInterface()
     : cache() {
 }
@@ -65,13 +85,18 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     std::string kernelFileHash;
+    std::vector<char> specConstantsKey;
+    if (cachingMode != CachingMode::None) {
+        specConstantsKey = getSpecConstantsCacheKey(input.specializedValues);
+    }
+
     if (cachingMode == CachingMode::Direct) {
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
                                                   input.src,
                                                   input.apiOptions,
-                                                  input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+                                                  input.internalOptions,
+                                                  specConstantsKey);
+        if (loadCachedDeviceBinary(kernelFileHash, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -122,9 +147,9 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                   input.apiOptions,
-                                                  input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+                                                  input.internalOptions,
+                                                  specConstantsKey);
+        if (loadCachedDeviceBinary(kernelFileHash, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -145,7 +170,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     if (input.allowCaching) {
-        cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+        cacheDeviceBinary(device, kernelFileHash, igcOutput->GetOutput());
     }
 
     TranslationOutput::makeCopy(output.deviceBinary, igcOutput->GetOutput());
@@ -214,6 +239,17 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         return TranslationOutput::ErrorCode::UnknownError;
     }
 
+    std::string kernelFileHash;
+    if (input.allowCaching) {
+        kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
+                                                  input.src,
+                                                  input.apiOptions,
+                                                  input.internalOptions);
+        if (loadCachedDeviceBinary(kernelFileHash, output)) {
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     CIF::RAII::UPtr_t<IGC::OclTranslationOutputTagOCL> currOut;
     inSrc->Retain(); // shared with currSrc
     CIF::RAII::UPtr_t<CIF::Builtins::BufferSimple> currSrc(inSrc.get());
@@ -240,6 +276,10 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         currSrc.reset(currOut->GetOutput());
     }
 
+    if (input.allowCaching) {
+        cacheDeviceBinary(device, kernelFileHash, currOut->GetOutput());
+    }
+
     TranslationOutput::makeCopy(output.backendCompilerLog, currOut->GetBuildLog());
     TranslationOutput::makeCopy(output.deviceBinary, currOut->GetOutput());
     TranslationOutput::makeCopy(output.debugData, currOut->GetDebugData());
@@ -462,6 +502,33 @@ IGC::CodeType::CodeType_t CompilerInterface::getPreferredIntermediateRepresentat
     return getFclDeviceCtx(device)->GetPreferredIntermediateRepresentation();
 }
 
+void CompilerInterface::cacheDeviceBinary(const Device &device, const std::string &kernelFileHash, CIF::Builtins::BufferSimple *deviceBinary) {
+    cache->cacheBinary(kernelFileHash, deviceBinary->GetMemory<char>(), static_cast<uint32_t>(deviceBinary->GetSize<char>()));
+    if (DebugManager.flags.DisableZebinZeInfoBlob.get()) {
+        return;
+    }
+
+    // pre-decoded .ze_info is stored as separate entry, so that cached zebin stays identical to compiler output
+    auto binary = ArrayRef<const uint8_t>(deviceBinary->GetMemory<uint8_t>(), deviceBinary->GetSize<uint8_t>());
+    auto zeInfoBlob = createZeInfoBlob(binary, targetDeviceFromHwInfo(device.getHardwareInfo()));
+    if (false == zeInfoBlob.empty()) {
+        cache->cacheBinary(kernelFileHash + zeInfoBlobCacheKeySuffix.str(), reinterpret_cast<const char *>(zeInfoBlob.data()), static_cast<uint32_t>(zeInfoBlob.size()));
+    }
+}
+
+bool CompilerInterface::loadCachedDeviceBinary(const std::string &kernelFileHash, TranslationOutput &output) {
+    output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+    if (nullptr == output.deviceBinary.mem) {
+        return false;
+    }
+
+    auto binary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(output.deviceBinary.mem.get()), output.deviceBinary.size);
+    if (isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(binary) && (false == DebugManager.flags.DisableZebinZeInfoBlob.get())) {
+        output.zeInfoBlob.mem = cache->loadCachedBinary(kernelFileHash + zeInfoBlobCacheKeySuffix.str(), output.zeInfoBlob.size);
+    }
+    return true;
+}
+
 CIF::RAII::UPtr_t<IGC::FclOclTranslationCtxTagOCL> CompilerInterface::createFclTranslationCtx(const Device &device, IGC::CodeType::CodeType_t inType, IGC::CodeType::CodeType_t outType) {
     auto deviceCtx = getFclDeviceCtx(device);
     if (deviceCtx == nullptr) {
@@ -62,9 +62,16 @@ struct TranslationOutput {
         size_t size = 0;
     };
 
+    // device binary served by compiler cache is shared with the cache (and can be a read-only file mapping)
+    struct SharedMemAndSize {
+        std::shared_ptr<const char[]> mem;
+        size_t size = 0;
+    };
+
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::invalid;
     MemAndSize intermediateRepresentation;
-    MemAndSize deviceBinary;
+    SharedMemAndSize deviceBinary;
+    SharedMemAndSize zeInfoBlob; // pre-decoded .ze_info of device binary, set only on compiler cache hit
     MemAndSize debugData;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
@@ -88,6 +95,13 @@ struct TranslationOutput {
         dst.size = src->GetSize<char>();
         dst.mem = ::makeCopy(src->GetMemory<void>(), src->GetSize<char>());
     }
+
+    static void makeCopy(SharedMemAndSize &dst, CIF::Builtins::BufferSimple *src) {
+        MemAndSize copy;
+        makeCopy(copy, src);
+        dst.mem = std::move(copy.mem);
+        dst.size = copy.size;
+    }
 };
 
 struct SpecConstantInfo {
@@ -164,6 +178,8 @@ class CompilerInterface {
     MOCKABLE_VIRTUAL IGC::FclOclDeviceCtxTagOCL *getFclDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::IgcOclDeviceCtxTagOCL *getIgcDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::CodeType::CodeType_t getPreferredIntermediateRepresentation(const Device &device);
+    void cacheDeviceBinary(const Device &device, const std::string &kernelFileHash, CIF::Builtins::BufferSimple *deviceBinary);
+    bool loadCachedDeviceBinary(const std::string &kernelFileHash, TranslationOutput &output);
 
     MOCKABLE_VIRTUAL CIF::RAII::UPtr_t<IGC::FclOclTranslationCtxTagOCL> createFclTranslationCtx(const Device &device,
                                                                                                 IGC::CodeType::CodeType_t inType,
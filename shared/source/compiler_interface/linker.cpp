@@ -20,6 +20,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "RelocationInfo.h"
 
@@ -343,54 +344,66 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
     if (false == data.getTraits().requiresPatchingOfInstructionSegments) {
         return;
     }
-    UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    auto segIt = instructionsSegments.begin();
-    uint32_t segId = 0u;
-    for (auto relocsIt = data.getRelocationsInInstructionSegments().begin(), relocsEnd = data.getRelocationsInInstructionSegments().end();
-         relocsIt != relocsEnd; ++relocsIt, ++segIt, ++segId) {
-        auto &thisSegmentRelocs = *relocsIt;
-        const PatchableSegment &instSeg = *segIt;
-        for (const auto &relocation : thisSegmentRelocs) {
-            UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
-            bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
-            DEBUG_BREAK_IF(invalidOffset);
-
-            auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
-                *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
-                continue;
-            };
-            if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                if (pImplicitArgsRelocationAddresses.find(segId) == pImplicitArgsRelocationAddresses.end()) {
-                    pImplicitArgsRelocationAddresses.insert({segId, {}});
-                }
-                pImplicitArgsRelocationAddresses[segId].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-                continue;
+    const auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
+    UNRECOVERABLE_IF(relocationsPerSegment.size() > instructionsSegments.size());
+
+    // Segments are patched independently, results are merged in segment order afterwards
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(relocationsPerSegment.size());
+    std::vector<StackVec<uint32_t *, 2>> implicitArgsRelocationAddressesPerSegment(relocationsPerSegment.size());
+    parallelFor(relocationsPerSegment.size(), workersCount, [&](size_t segId) {
+        patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], relocationsPerSegment[segId], kernelDescriptors,
+                                 unresolvedExternalsPerSegment[segId], implicitArgsRelocationAddressesPerSegment[segId]);
+    });
+
+    for (uint32_t segId = 0u; segId < relocationsPerSegment.size(); segId++) {
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), unresolvedExternalsPerSegment[segId].begin(), unresolvedExternalsPerSegment[segId].end());
+        if (false == implicitArgsRelocationAddressesPerSegment[segId].empty()) {
+            auto &implicitArgsRelocationAddresses = pImplicitArgsRelocationAddresses[segId];
+            for (auto relocationAddress : implicitArgsRelocationAddressesPerSegment[segId]) {
+                implicitArgsRelocationAddresses.push_back(relocationAddress);
             }
-            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-            if (symbolIt == relocatedSymbols.end()) {
-                auto localSymbolIt = localRelocatedSymbols.find(relocation.symbolName);
-                if (localRelocatedSymbols.end() != localSymbolIt) {
-                    if (localSymbolIt->first == kernelDescriptors[segId]->kernelMetadata.kernelName) {
-                        uint64_t patchValue = localSymbolIt->second.gpuAddress + relocation.addend;
-                        patchAddress(relocAddress, patchValue, relocation);
-                        continue;
-                    }
-                } else if (relocation.symbolName.empty()) {
-                    uint64_t patchValue = 0;
+        }
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &instSeg, const LinkerInput::Relocations &relocations, const KernelDescriptorsT &kernelDescriptors,
+                                      std::vector<UnresolvedExternal> &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses) const {
+    for (const auto &relocation : relocations) {
+        UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
+        bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
+        DEBUG_BREAK_IF(invalidOffset);
+
+        auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
+            *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
+            continue;
+        };
+        if (relocation.symbolName == implicitArgsRelocationSymbolName) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+            continue;
+        }
+        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+        if (symbolIt == relocatedSymbols.end()) {
+            auto localSymbolIt = localRelocatedSymbols.find(relocation.symbolName);
+            if (localRelocatedSymbols.end() != localSymbolIt) {
+                if (localSymbolIt->first == kernelDescriptors[segId]->kernelMetadata.kernelName) {
+                    uint64_t patchValue = localSymbolIt->second.gpuAddress + relocation.addend;
                     patchAddress(relocAddress, patchValue, relocation);
                     continue;
                 }
-            }
-            bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
-            if (invalidOffset || unresolvedExternal) {
-                uint32_t segId = static_cast<uint32_t>(segIt - instructionsSegments.begin());
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
+            } else if (relocation.symbolName.empty()) {
+                uint64_t patchValue = 0;
+                patchAddress(relocAddress, patchValue, relocation);
                 continue;
             }
-            uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-            patchAddress(relocAddress, patchValue, relocation);
         }
+        bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
+        if (invalidOffset || unresolvedExternal) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
+            continue;
+        }
+        uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
+        patchAddress(relocAddress, patchValue, relocation);
     }
 }
 
@@ -219,6 +219,10 @@ struct Linker {
         : data(data) {
     }
 
+    Linker(const LinkerInput &data, uint32_t workersCount)
+        : data(data), workersCount(workersCount) {
+    }
+
     LinkingStatus link(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo, const SegmentInfo &exportedFunctionsSegInfo, const SegmentInfo &globalStringsSegInfo,
                        GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg, const PatchableSegments &instructionsSegments,
                        UnresolvedExternals &outUnresolvedExternals, Device *pDevice, const void *constantsInitData, const void *variablesInitData,
@@ -261,6 +265,8 @@ struct Linker {
     bool processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments);
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &instSeg, const LinkerInput::Relocations &relocations, const KernelDescriptorsT &kernelDescriptors,
+                                  std::vector<UnresolvedExternal> &outUnresolvedExternals, StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses) const;
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
@@ -275,6 +281,7 @@ struct Linker {
     void patchIncrement(Device *pDevice, GraphicsAllocation *dstAllocation, size_t relocationOffset, const void *initData, uint64_t incrementValue);
 
     std::unordered_map<uint32_t /*ISA segment id*/, StackVec<uint32_t *, 2> /*implicit args relocation address to patch*/> pImplicitArgsRelocationAddresses;
+    uint32_t workersCount = 1u; // instruction segments are patched in parallel when greater than 1
 };
 
 std::string constructLinkerErrorMessage(const Linker::UnresolvedExternals &unresolvedExternals, const std::vector<std::string> &instructionsSegmentsNames);
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include "os_inc.h"
+
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::vector<CompilerCache::CacheEntryInfo> CompilerCache::getCacheEntries() {
+    std::vector<CacheEntryInfo> entries;
+
+    DIR *dir = opendir(config.cacheDir.c_str());
+    if (dir == nullptr) {
+        return entries;
+    }
+
+    auto now = time(nullptr);
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        bool isTempFile = isCacheTempFileName(entry->d_name);
+        if (false == isTempFile && false == isCacheEntryFileName(entry->d_name)) {
+            continue;
+        }
+
+        CacheEntryInfo entryInfo;
+        entryInfo.path = config.cacheDir + PATH_SEPARATOR + entry->d_name;
+
+        struct stat statBuffer = {};
+        if (0 != stat(entryInfo.path.c_str(), &statBuffer) || false == S_ISREG(statBuffer.st_mode)) {
+            continue;
+        }
+        entryInfo.size = static_cast<size_t>(statBuffer.st_size);
+        entryInfo.lastAccessTime = static_cast<uint64_t>(statBuffer.st_atim.tv_sec) * 1000000000ull + statBuffer.st_atim.tv_nsec;
+        entryInfo.isTempFile = isTempFile;
+        // pids in temp file names may come from other pid namespaces sharing the directory, so only the age is checked
+        entryInfo.isStaleTempFile = isTempFile && (static_cast<int64_t>(now) - static_cast<int64_t>(statBuffer.st_mtim.tv_sec) > static_cast<int64_t>(staleTempFileAgeInSeconds));
+        entries.push_back(std::move(entryInfo));
+    }
+
+    closedir(dir);
+    return entries;
+}
+
+bool CompilerCache::renameTempFileToProperName(const std::string &tempFilePath, const std::string &filePath) {
+    return 0 == ::rename(tempFilePath.c_str(), filePath.c_str());
+}
+
+void CompilerCache::markCacheEntryAccessed(const std::string &filePath) {
+    // atime is not reliable with relatime/noatime mounts, so it is refreshed explicitly
+    utimes(filePath.c_str(), nullptr);
+}
+
+CompilerCacheMemoryTier::BinaryT CompilerCache::mapCacheEntry(const std::string &filePath, size_t minFileSize, size_t &binarySize, bool &isCorrupted) {
+    binarySize = 0u;
+    isCorrupted = false;
+
+    int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat statBuffer = {};
+    void *mapping = MAP_FAILED;
+    size_t fileSize = 0u;
+    std::string entryIdentity;
+    if (0 == ::fstat(fd, &statBuffer)) {
+        entryIdentity = filePath + ":" + std::to_string(statBuffer.st_ino) + ":" + std::to_string(statBuffer.st_size) + ":" +
+                        std::to_string(statBuffer.st_mtim.tv_sec) + "." + std::to_string(statBuffer.st_mtim.tv_nsec);
+        fileSize = static_cast<size_t>(statBuffer.st_size);
+        if (fileSize >= minFileSize && fileSize > sizeof(CompilerCacheEntryHeader)) {
+            mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+    }
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        // small entries and failed mappings fall back to reading the file
+        return nullptr;
+    }
+
+    auto header = reinterpret_cast<const CompilerCacheEntryHeader *>(mapping);
+    auto binary = reinterpret_cast<const char *>(mapping) + sizeof(CompilerCacheEntryHeader);
+    bool valid = isValidCacheEntryHeader(*header, fileSize);
+    if (valid) {
+        // checksumming touches every page of the mapping, so it is done only on the first hit of given file
+        std::lock_guard<std::mutex> lock(verifiedEntriesMtx);
+        if (verifiedEntries.count(entryIdentity) == 0u) {
+            valid = (header->checksum == computeChecksum(binary, static_cast<size_t>(header->binarySize)));
+            if (valid) {
+                verifiedEntries.insert(entryIdentity);
+            }
+        }
+    }
+    if (false == valid) {
+        ::munmap(mapping, fileSize);
+        isCorrupted = true;
+        return nullptr;
+    }
+
+    binarySize = static_cast<size_t>(header->binarySize);
+    return CompilerCacheMemoryTier::BinaryT(binary, [mapping, fileSize](const char *) {
+        ::munmap(mapping, fileSize);
+    });
+}
+
+} // namespace NEO
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+#include "os_inc.h"
+
+namespace NEO {
+
+std::vector<CompilerCache::CacheEntryInfo> CompilerCache::getCacheEntries() {
+    std::vector<CacheEntryInfo> entries;
+
+    WIN32_FIND_DATAA ffd;
+    // matches temp files of stores too (see getTempFilePath)
+    std::string searchPath = config.cacheDir + PATH_SEPARATOR + "*" + config.cacheFileExtension + "*";
+    HANDLE hFind = FindFirstFileA(searchPath.c_str(), &ffd);
+    if (INVALID_HANDLE_VALUE == hFind) {
+        return entries;
+    }
+
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    auto nowTicks = (static_cast<uint64_t>(now.dwHighDateTime) << 32) | now.dwLowDateTime;
+    constexpr uint64_t ticksPerSecond = 10000000u; // FILETIME is in 100ns units
+
+    do {
+        bool isTempFile = isCacheTempFileName(ffd.cFileName);
+        if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) || (false == isTempFile && false == isCacheEntryFileName(ffd.cFileName))) {
+            continue;
+        }
+        CacheEntryInfo entryInfo;
+        entryInfo.path = config.cacheDir + PATH_SEPARATOR + ffd.cFileName;
+        entryInfo.size = static_cast<size_t>((static_cast<uint64_t>(ffd.nFileSizeHigh) << 32) | ffd.nFileSizeLow);
+        entryInfo.lastAccessTime = (static_cast<uint64_t>(ffd.ftLastAccessTime.dwHighDateTime) << 32) | ffd.ftLastAccessTime.dwLowDateTime;
+        auto lastWriteTicks = (static_cast<uint64_t>(ffd.ftLastWriteTime.dwHighDateTime) << 32) | ffd.ftLastWriteTime.dwLowDateTime;
+        entryInfo.isTempFile = isTempFile;
+        entryInfo.isStaleTempFile = isTempFile && (nowTicks > lastWriteTicks) && (nowTicks - lastWriteTicks > staleTempFileAgeInSeconds * ticksPerSecond);
+        entries.push_back(std::move(entryInfo));
+    } while (FindNextFileA(hFind, &ffd) != 0);
+
+    FindClose(hFind);
+    return entries;
+}
+
+bool CompilerCache::renameTempFileToProperName(const std::string &tempFilePath, const std::string &filePath) {
+    return FALSE != MoveFileExA(tempFilePath.c_str(), filePath.c_str(), MOVEFILE_REPLACE_EXISTING);
+}
+
+void CompilerCache::markCacheEntryAccessed(const std::string &filePath) {
+    HANDLE hFile = CreateFileA(filePath.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == hFile) {
+        return;
+    }
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(hFile, nullptr, &now, nullptr);
+    CloseHandle(hFile);
+}
+
+CompilerCacheMemoryTier::BinaryT CompilerCache::mapCacheEntry(const std::string &filePath, size_t minFileSize, size_t &binarySize, bool &isCorrupted) {
+    // A mapped file can be neither replaced nor deleted on Windows, which would block
+    // publishing and evicting entries, so entries are always read into memory.
+    binarySize = 0u;
+    isCorrupted = false;
+    return nullptr;
+}
+
+} // namespace NEO
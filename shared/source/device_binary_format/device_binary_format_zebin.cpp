@@ -96,6 +96,7 @@ DecodeError decodeSingleZebin(ProgramInfo &dst, const SingleDeviceBinary &src, s
 
     dst.grfSize = src.targetDevice.grfSize;
     dst.minScratchSpaceSize = src.targetDevice.minScratchSpaceSize;
+    dst.zeInfoBlob = src.zeInfoBlob;
     auto decodeError = decodeZebin<numBits>(dst, elf, outErrReason, outWarning);
     prepareLinkerInputForZebin<numBits>(dst, elf);
     return decodeError;
@@ -73,6 +73,7 @@ struct SingleDeviceBinary {
     ArrayRef<const uint8_t> packedTargetDeviceBinary;
     ConstStringRef buildOptions;
     TargetDevice targetDevice;
+    ArrayRef<const uint8_t> zeInfoBlob; // pre-decoded .ze_info served by compiler cache, never taken from the binary itself
 };
 
 template <DeviceBinaryFormat Format>
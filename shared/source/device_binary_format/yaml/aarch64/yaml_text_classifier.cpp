@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+TextClassification (*TextClassifier::classify)(ConstStringRef text) = classifyTextScalar;
+
+// Select vectorized classifier based on CPU capabilities
+TextClassifier::TextClassifier() {
+    bool supportsNEON = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureNeon);
+    if (supportsNEON) {
+        TextClassifier::classify = classifyTextSimd<TextClassifierNeon>;
+    }
+}
+
+TextClassifier TextClassifier::initializer;
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.inl"
+
+#include <arm_neon.h>
+
+namespace NEO {
+
+namespace Yaml {
+
+struct TextClassifierNeon {
+    static constexpr size_t numChannels = 16U;
+
+    static inline uint8x16_t matchAny(uint8x16_t chars, char c0, char c1, char c2, char c3) {
+        auto m01 = vorrq_u8(vceqq_u8(chars, vdupq_n_u8(c0)), vceqq_u8(chars, vdupq_n_u8(c1)));
+        auto m23 = vorrq_u8(vceqq_u8(chars, vdupq_n_u8(c2)), vceqq_u8(chars, vdupq_n_u8(c3)));
+        return vorrq_u8(m01, m23);
+    }
+
+    static inline size_t countMatches(uint8x16_t mask) {
+        return vaddvq_u8(vshrq_n_u8(mask, 7));
+    }
+
+    static inline void classifyChunk(const char *pos, TextClassification &out) {
+        auto curr = vld1q_u8(reinterpret_cast<const uint8_t *>(pos));
+        auto prev = vld1q_u8(reinterpret_cast<const uint8_t *>(pos - 1));
+
+        auto newLines = vceqq_u8(curr, vdupq_n_u8('\n'));
+        auto delimiters = matchAny(curr, ':', ',', '[', ']');
+        auto currSeparators = vorrq_u8(matchAny(curr, ' ', '\t', '\r', '\n'), delimiters);
+        auto prevSeparators = vorrq_u8(matchAny(prev, ' ', '\t', '\r', '\n'), matchAny(prev, ':', ',', '[', ']'));
+        auto tokenStarts = vbicq_u8(prevSeparators, currSeparators);
+
+        auto numNewLines = countMatches(newLines);
+        out.numLines += numNewLines;
+        out.numTokensEstimate += numNewLines + countMatches(delimiters) + countMatches(tokenStarts);
+    }
+};
+
+template TextClassification classifyTextSimd<TextClassifierNeon>(ConstStringRef text);
+
+} // namespace Yaml
+
+} // namespace NEO
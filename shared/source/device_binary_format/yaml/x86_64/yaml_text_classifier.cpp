@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+TextClassification (*TextClassifier::classify)(ConstStringRef text) = classifyTextSimd<TextClassifierSse4>;
+
+// Select widest classifier based on CPU capabilities
+TextClassifier::TextClassifier() {
+    bool supportsAVX2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    if (supportsAVX2) {
+        TextClassifier::classify = classifyTextSimd<TextClassifierAvx2>;
+    }
+}
+
+TextClassifier TextClassifier::initializer;
+
+} // namespace Yaml
+
+} // namespace NEO
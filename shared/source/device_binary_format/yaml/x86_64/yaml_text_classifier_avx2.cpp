@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.inl"
+
+#include <immintrin.h>
+
+namespace NEO {
+
+namespace Yaml {
+
+struct TextClassifierAvx2 {
+    static constexpr size_t numChannels = 32U;
+
+    static inline __m256i matchAny(__m256i chars, char c0, char c1, char c2, char c3) {
+        auto m01 = _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(c0)), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(c1)));
+        auto m23 = _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(c2)), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(c3)));
+        return _mm256_or_si256(m01, m23);
+    }
+
+    static inline void classifyChunk(const char *pos, TextClassification &out) {
+        auto curr = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+        auto prev = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos - 1));
+
+        auto newLines = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(curr, _mm256_set1_epi8('\n'))));
+        auto delimiters = static_cast<uint32_t>(_mm256_movemask_epi8(matchAny(curr, ':', ',', '[', ']')));
+        auto currSeparators = static_cast<uint32_t>(_mm256_movemask_epi8(matchAny(curr, ' ', '\t', '\r', '\n'))) | delimiters;
+        auto prevSeparators = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(matchAny(prev, ' ', '\t', '\r', '\n'), matchAny(prev, ':', ',', '[', ']'))));
+        auto tokenStarts = prevSeparators & ~currSeparators;
+
+        auto numNewLines = static_cast<size_t>(_mm_popcnt_u32(newLines));
+        out.numLines += numNewLines;
+        out.numTokensEstimate += numNewLines + _mm_popcnt_u32(delimiters) + _mm_popcnt_u32(tokenStarts);
+    }
+};
+
+template TextClassification classifyTextSimd<TextClassifierAvx2>(ConstStringRef text);
+
+} // namespace Yaml
+
+} // namespace NEO
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.inl"
+
+#include <nmmintrin.h>
+
+namespace NEO {
+
+namespace Yaml {
+
+struct TextClassifierSse4 {
+    static constexpr size_t numChannels = 16U;
+
+    static inline __m128i matchAny(__m128i chars, char c0, char c1, char c2, char c3) {
+        auto m01 = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(c0)), _mm_cmpeq_epi8(chars, _mm_set1_epi8(c1)));
+        auto m23 = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(c2)), _mm_cmpeq_epi8(chars, _mm_set1_epi8(c3)));
+        return _mm_or_si128(m01, m23);
+    }
+
+    static inline void classifyChunk(const char *pos, TextClassification &out) {
+        auto curr = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+        auto prev = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos - 1));
+
+        auto newLines = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(curr, _mm_set1_epi8('\n'))));
+        auto delimiters = static_cast<uint32_t>(_mm_movemask_epi8(matchAny(curr, ':', ',', '[', ']')));
+        auto currSeparators = static_cast<uint32_t>(_mm_movemask_epi8(matchAny(curr, ' ', '\t', '\r', '\n'))) | delimiters;
+        auto prevSeparators = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(matchAny(prev, ' ', '\t', '\r', '\n'), matchAny(prev, ':', ',', '[', ']'))));
+        auto tokenStarts = prevSeparators & ~currSeparators;
+
+        auto numNewLines = static_cast<size_t>(_mm_popcnt_u32(newLines));
+        out.numLines += numNewLines;
+        out.numTokensEstimate += numNewLines + _mm_popcnt_u32(delimiters) + _mm_popcnt_u32(tokenStarts);
+    }
+};
+
+template TextClassification classifyTextSimd<TextClassifierSse4>(ConstStringRef text);
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+TextClassification classifyTextScalar(ConstStringRef text) {
+    TextClassification ret;
+    char prev = '\n';
+    for (auto curr : text) {
+        classifyCharacter(prev, curr, ret);
+        prev = curr;
+    }
+    return ret;
+}
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/device_binary_format/yaml/yaml_parser.h"
+
+#include <cstddef>
+
+namespace NEO {
+
+namespace Yaml {
+
+// Bulk statistics of yaml text - used by tokenizer to pre-size its caches
+struct TextClassification {
+    size_t numLines = 0U;
+    size_t numTokensEstimate = 0U;
+};
+
+constexpr bool isDelimiterCharacter(char c) {
+    return (':' == c) | (',' == c) | ('[' == c) | (']' == c);
+}
+
+constexpr bool isSeparatorCharacter(char c) {
+    return isWhitespace(c) | isDelimiterCharacter(c);
+}
+
+// Every newline and delimiter is counted as a token, and so is every character that starts a run of non-separator characters
+inline void classifyCharacter(char prev, char curr, TextClassification &out) {
+    size_t isNewLine = ('\n' == curr) ? 1U : 0U;
+    size_t isDelimiter = isDelimiterCharacter(curr) ? 1U : 0U;
+    size_t isTokenStart = (isSeparatorCharacter(prev) && (false == isSeparatorCharacter(curr))) ? 1U : 0U;
+    out.numLines += isNewLine;
+    out.numTokensEstimate += isNewLine + isDelimiter + isTokenStart;
+}
+
+TextClassification classifyTextScalar(ConstStringRef text);
+
+template <typename ClassifierT>
+TextClassification classifyTextSimd(ConstStringRef text);
+
+struct TextClassifierSse4;
+struct TextClassifierAvx2;
+struct TextClassifierNeon;
+
+struct TextClassifier {
+    static TextClassification (*classify)(ConstStringRef text);
+
+    static TextClassifier initializer;
+
+  private:
+    TextClassifier();
+};
+
+} // namespace Yaml
+
+} // namespace NEO
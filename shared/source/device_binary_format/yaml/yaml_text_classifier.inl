@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+template <typename ClassifierT>
+TextClassification classifyTextSimd(ConstStringRef text) {
+    TextClassification ret;
+    if (text.empty()) {
+        return ret;
+    }
+
+    // chunks read one character behind their beginning, so first character is handled separately
+    classifyCharacter('\n', text[0], ret);
+    auto pos = text.begin() + 1;
+    for (; pos + ClassifierT::numChannels <= text.end(); pos += ClassifierT::numChannels) {
+        ClassifierT::classifyChunk(pos, ret);
+    }
+    for (; pos < text.end(); ++pos) {
+        classifyCharacter(pos[-1], pos[0], ret);
+    }
+    return ret;
+}
+
+} // namespace Yaml
+
+} // namespace NEO
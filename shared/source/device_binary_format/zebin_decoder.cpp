@@ -15,6 +15,7 @@
 #include "shared/source/device_binary_format/elf/zebin_elf.h"
 #include "shared/source/device_binary_format/elf/zeinfo_enum_lookup.h"
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/device_binary_format/zeinfo_blob.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
@@ -22,6 +23,7 @@
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <iterator>
 #include <tuple>
 
 namespace NEO {
@@ -1082,6 +1084,21 @@ NEO::DecodeError populateKernelDescriptor(const NEO::Elf::ZebinKernelMetadata::T
     return DecodeError::Success;
 }
 
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+typename ZebinSections<numBits>::SectionHeaderData *getKernelTextSection(NEO::Elf::Elf<numBits> &elf, NEO::ZebinSections<numBits> &zebinSections, ConstStringRef kernelName) {
+    typename ZebinSections<numBits>::SectionHeaderData *correspondingTextSegment = nullptr;
+    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
+    for (auto *textSection : zebinSections.textKernelSections) {
+        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
+        auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
+        if (sufix == kernelName) {
+            correspondingTextSegment = textSection;
+        }
+    }
+    return correspondingTextSegment;
+}
+
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
 NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, NEO::ZebinSections<numBits> &zebinSections,
                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning) {
@@ -1322,17 +1339,7 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<n
         kernelDescriptor.generatedHeaps.resize(kernelDescriptor.generatedHeaps.size() + generatedDshSize);
     }
 
-    typename ZebinSections<numBits>::SectionHeaderData *correspondingTextSegment = nullptr;
-    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
-    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
-    for (auto *textSection : zebinSections.textKernelSections) {
-        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
-        auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
-        if (sufix == kernelDescriptor.kernelMetadata.kernelName) {
-            correspondingTextSegment = textSection;
-        }
-    }
-
+    auto correspondingTextSegment = getKernelTextSection(elf, zebinSections, kernelDescriptor.kernelMetadata.kernelName);
     if (nullptr == correspondingTextSegment) {
         outErrReason.append("DeviceBinaryFormat::Zebin : Could not find text section for kernel " + kernelDescriptor.kernelMetadata.kernelName + "\n");
         return DecodeError::InvalidBinary;
@@ -1448,44 +1455,53 @@ NEO::DecodeError populateKernelSourceAttributes(NEO::KernelDescriptor &dst, NEO:
     return DecodeError::Success;
 }
 
-template NEO::DecodeError decodeZebin<Elf::EI_CLASS_32>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_32> &elf, std::string &outErrReason, std::string &outWarning);
-template NEO::DecodeError decodeZebin<Elf::EI_CLASS_64>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, std::string &outErrReason, std::string &outWarning);
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
-NEO::DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning) {
-    ZebinSections<numBits> zebinSections;
-    auto extractError = extractZebinSections(elf, zebinSections, outErrReason, outWarning);
-    if (DecodeError::Success != extractError) {
-        return extractError;
+bool decodeZeInfoBlob(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, ZebinSections<numBits> &zebinSections, std::string &outWarning) {
+    // blob is trusted only when passed by the driver (served by compiler cache) - it is never read from the zebin itself
+    if (dst.zeInfoBlob.empty() || NEO::DebugManager.flags.DisableZebinZeInfoBlob.get()) {
+        return false;
     }
 
-    extractError = validateZebinSectionsCount(zebinSections, outErrReason, outWarning);
-    if (DecodeError::Success != extractError) {
-        return extractError;
+    ZeInfoBlobContent blobContent;
+    if (false == deserializeZeInfoBlob(blobContent, dst.zeInfoBlob, zebinSections.zeInfoSections[0]->data, dst)) {
+        return false;
     }
 
-    if (false == zebinSections.globalDataSections.empty()) {
-        dst.globalVariables.initData = zebinSections.globalDataSections[0]->data.begin();
-        dst.globalVariables.size = zebinSections.globalDataSections[0]->data.size();
+    // On version mismatch .ze_info gets parsed, so that the error is reported the same way.
+    // Version warning is not reported here - it is already part of warnings stored in the blob.
+    std::string versionErrReason;
+    std::string versionWarning;
+    if (DecodeError::Success != validateZeInfoVersion(blobContent.zeInfoVersion, versionErrReason, versionWarning)) {
+        return false;
     }
 
-    if (false == zebinSections.constDataSections.empty()) {
-        dst.globalConstants.initData = zebinSections.constDataSections[0]->data.begin();
-        dst.globalConstants.size = zebinSections.constDataSections[0]->data.size();
+    for (auto &kernelInfo : blobContent.kernelInfos) {
+        auto correspondingTextSegment = getKernelTextSection(elf, zebinSections, kernelInfo->kernelDescriptor.kernelMetadata.kernelName);
+        if (nullptr == correspondingTextSegment) {
+            return false;
+        }
+        kernelInfo->heapInfo.pKernelHeap = correspondingTextSegment->data.begin();
+        kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
+        kernelInfo->heapInfo.KernelUnpaddedSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
     }
 
-    if (false == zebinSections.constDataStringSections.empty()) {
-        dst.globalStrings.initData = zebinSections.constDataStringSections[0]->data.begin();
-        dst.globalStrings.size = zebinSections.constDataStringSections[0]->data.size();
+    dst.kernelInfos.reserve(dst.kernelInfos.size() + blobContent.kernelInfos.size());
+    for (auto &kernelInfo : blobContent.kernelInfos) {
+        dst.kernelInfos.push_back(kernelInfo.release());
     }
-
-    if (false == zebinSections.symtabSections.empty()) {
-        outWarning.append("DeviceBinaryFormat::Zebin : Ignoring symbol table\n");
+    for (auto &nameMapping : blobContent.globalsDeviceToHostNameMap) {
+        dst.globalsDeviceToHostNameMap[nameMapping.first] = std::move(nameMapping.second);
     }
+    std::move(blobContent.externalFunctions.begin(), blobContent.externalFunctions.end(), std::back_inserter(dst.externalFunctions));
+    outWarning.append(blobContent.zeInfoWarnings);
+    return true;
+}
 
-    if (zebinSections.zeInfoSections.empty()) {
-        outWarning.append("DeviceBinaryFormat::Zebin : Expected at least one " + NEO::Elf::SectionsNamesZebin::zeInfo.str() + " section, got 0\n");
-        return DecodeError::Success;
-    }
+template NEO::DecodeError decodeZeInfo<Elf::EI_CLASS_32>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_32> &elf, ZebinSections<Elf::EI_CLASS_32> &zebinSections, NEO::Elf::ZebinKernelMetadata::Types::Version &outZeInfoVersion, std::string &outErrReason, std::string &outWarning);
+template NEO::DecodeError decodeZeInfo<Elf::EI_CLASS_64>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, ZebinSections<Elf::EI_CLASS_64> &zebinSections, NEO::Elf::ZebinKernelMetadata::Types::Version &outZeInfoVersion, std::string &outErrReason, std::string &outWarning);
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+NEO::DecodeError decodeZeInfo(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, ZebinSections<numBits> &zebinSections, NEO::Elf::ZebinKernelMetadata::Types::Version &outZeInfoVersion, std::string &outErrReason, std::string &outWarning) {
+    outZeInfoVersion = zeInfoDecoderVersion;
 
     auto metadataSectionData = zebinSections.zeInfoSections[0]->data;
     ConstStringRef metadataString(reinterpret_cast<const char *>(metadataSectionData.begin()), metadataSectionData.size());
@@ -1524,18 +1540,17 @@ NEO::DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std:
         return DecodeError::InvalidBinary;
     }
 
-    NEO::Elf::ZebinKernelMetadata::Types::Version zeInfoVersion = zeInfoDecoderVersion;
     if (versionSectionNodes.empty()) {
         outWarning.append("DeviceBinaryFormat::Zebin::" + NEO::Elf::SectionsNamesZebin::zeInfo.str() + " : No version info provided (i.e. no " + NEO::Elf::ZebinKernelMetadata::Tags::version.str() + " entry in global scope of DeviceBinaryFormat::Zebin::" + NEO::Elf::SectionsNamesZebin::zeInfo.str() + ") - will use decoder's default : \'" + std::to_string(zeInfoDecoderVersion.major) + "." + std::to_string(zeInfoDecoderVersion.minor) + "\'\n");
-        zeInfoVersion = zeInfoDecoderVersion;
+        outZeInfoVersion = zeInfoDecoderVersion;
     } else {
-        auto zeInfoErr = readZeInfoVersionFromZeInfo(zeInfoVersion, yamlParser, *versionSectionNodes[0], outErrReason, outWarning);
+        auto zeInfoErr = readZeInfoVersionFromZeInfo(outZeInfoVersion, yamlParser, *versionSectionNodes[0], outErrReason, outWarning);
         if (DecodeError::Success != zeInfoErr) {
             return zeInfoErr;
         }
     }
 
-    auto zeInfoVersionError = validateZeInfoVersion(zeInfoVersion, outErrReason, outWarning);
+    auto zeInfoVersionError = validateZeInfoVersion(outZeInfoVersion, outErrReason, outWarning);
     if (DecodeError::Success != zeInfoVersionError) {
         return zeInfoVersionError;
     }
@@ -1586,4 +1601,51 @@ NEO::DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std:
     return DecodeError::Success;
 }
 
+template NEO::DecodeError decodeZebin<Elf::EI_CLASS_32>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_32> &elf, std::string &outErrReason, std::string &outWarning);
+template NEO::DecodeError decodeZebin<Elf::EI_CLASS_64>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, std::string &outErrReason, std::string &outWarning);
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+NEO::DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning) {
+    ZebinSections<numBits> zebinSections;
+    auto extractError = extractZebinSections(elf, zebinSections, outErrReason, outWarning);
+    if (DecodeError::Success != extractError) {
+        return extractError;
+    }
+
+    extractError = validateZebinSectionsCount(zebinSections, outErrReason, outWarning);
+    if (DecodeError::Success != extractError) {
+        return extractError;
+    }
+
+    if (false == zebinSections.globalDataSections.empty()) {
+        dst.globalVariables.initData = zebinSections.globalDataSections[0]->data.begin();
+        dst.globalVariables.size = zebinSections.globalDataSections[0]->data.size();
+    }
+
+    if (false == zebinSections.constDataSections.empty()) {
+        dst.globalConstants.initData = zebinSections.constDataSections[0]->data.begin();
+        dst.globalConstants.size = zebinSections.constDataSections[0]->data.size();
+    }
+
+    if (false == zebinSections.constDataStringSections.empty()) {
+        dst.globalStrings.initData = zebinSections.constDataStringSections[0]->data.begin();
+        dst.globalStrings.size = zebinSections.constDataStringSections[0]->data.size();
+    }
+
+    if (false == zebinSections.symtabSections.empty()) {
+        outWarning.append("DeviceBinaryFormat::Zebin : Ignoring symbol table\n");
+    }
+
+    if (zebinSections.zeInfoSections.empty()) {
+        outWarning.append("DeviceBinaryFormat::Zebin : Expected at least one " + NEO::Elf::SectionsNamesZebin::zeInfo.str() + " section, got 0\n");
+        return DecodeError::Success;
+    }
+
+    if (decodeZeInfoBlob(dst, elf, zebinSections, outWarning)) {
+        return DecodeError::Success;
+    }
+
+    NEO::Elf::ZebinKernelMetadata::Types::Version zeInfoVersion;
+    return decodeZeInfo(dst, elf, zebinSections, zeInfoVersion, outErrReason, outWarning);
+}
+
 } // namespace NEO
@@ -129,6 +129,9 @@ NEO::DecodeError populateExternalFunctionsMetadata(NEO::ProgramInfo &dst, NEO::Y
 
 NEO::DecodeError populateKernelSourceAttributes(NEO::KernelDescriptor &dst, NEO::Elf::ZebinKernelMetadata::Types::Kernel::Attributes::AttributesBaseT &attributes);
 
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+NEO::DecodeError decodeZeInfo(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, ZebinSections<numBits> &zebinSections, NEO::Elf::ZebinKernelMetadata::Types::Version &outZeInfoVersion, std::string &outErrReason, std::string &outWarning);
+
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
 NEO::DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning);
 
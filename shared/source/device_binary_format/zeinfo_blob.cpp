@@ -0,0 +1,495 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/zeinfo_blob.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/device_binary_format/elf/zebin_elf.h"
+#include "shared/source/device_binary_format/zebin_decoder.h"
+#include "shared/source/helpers/neo_driver_version.h"
+#include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+namespace NEO {
+
+namespace {
+
+constexpr uint32_t getLayoutId() {
+    uint32_t layoutId = 0u;
+    for (auto size : {sizeof(KernelDescriptor::KernelAttributes),
+                      sizeof(KernelDescriptor::entryPoints),
+                      sizeof(KernelDescriptor::PayloadMappings::dispatchTraits),
+                      sizeof(KernelDescriptor::PayloadMappings::bindingTable),
+                      sizeof(KernelDescriptor::PayloadMappings::samplerTable),
+                      sizeof(KernelDescriptor::PayloadMappings::implicitArgs),
+                      sizeof(ArgDescPointer),
+                      sizeof(ArgDescImage),
+                      sizeof(ArgDescSampler),
+                      sizeof(ArgDescValue::Element),
+                      sizeof(ArgTypeTraits),
+                      sizeof(decltype(KernelDescriptor::kernelMetadata)::ByValueArgument)}) {
+        layoutId = layoutId * 31u + static_cast<uint32_t>(size);
+    }
+    return layoutId;
+}
+
+// KernelDescriptor members are stored as raw bytes, so blob is valid only for the driver build that created it
+uint64_t getDriverBuildId() {
+    std::string buildId = driverVersion;
+#ifdef NEO_REVISION
+    buildId.append(NEO_REVISION);
+#endif
+    return Hash::hash(buildId.data(), buildId.size());
+}
+
+class BlobWriter {
+  public:
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written directly");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void write(const std::string &value) {
+        write(static_cast<uint32_t>(value.size()));
+        writeBytes(value.data(), value.size());
+    }
+
+    void writeBytes(const void *ptr, size_t size) {
+        auto bytes = reinterpret_cast<const uint8_t *>(ptr);
+        data.insert(data.end(), bytes, bytes + size);
+    }
+
+    std::vector<uint8_t> data;
+};
+
+class BlobReader {
+  public:
+    BlobReader(ArrayRef<const uint8_t> data) : data(data) {}
+
+    template <typename T>
+    bool read(T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read directly");
+        return readBytes(&value, sizeof(T));
+    }
+
+    bool read(std::string &value) {
+        uint32_t size = 0u;
+        if ((false == read(size)) || (size > getRemainingSize())) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char *>(data.begin() + offset), size);
+        offset += size;
+        return true;
+    }
+
+    bool readBytes(void *ptr, size_t size) {
+        if (size > getRemainingSize()) {
+            return false;
+        }
+        memcpy(ptr, data.begin() + offset, size);
+        offset += size;
+        return true;
+    }
+
+    size_t getRemainingSize() const {
+        return data.size() - offset;
+    }
+
+  protected:
+    ArrayRef<const uint8_t> data;
+    size_t offset = 0u;
+};
+
+void writeArgDescriptor(BlobWriter &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo().packed);
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::ArgTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::ArgTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::ArgTValue: {
+        auto &elements = arg.as<ArgDescValue>().elements;
+        writer.write(static_cast<uint32_t>(elements.size()));
+        for (const auto &element : elements) {
+            writer.write(element);
+        }
+        break;
+    }
+    }
+}
+
+bool readArgDescriptor(BlobReader &reader, ArgDescriptor &arg) {
+    ArgDescriptor::ArgType type = ArgDescriptor::ArgTUnknown;
+    if (false == reader.read(type)) {
+        return false;
+    }
+    arg = ArgDescriptor(type);
+    bool valid = reader.read(arg.getTraits());
+    valid &= reader.read(arg.getExtendedTypeInfo().packed);
+    switch (type) {
+    default:
+        return false;
+    case ArgDescriptor::ArgTUnknown:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        valid &= reader.read(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::ArgTImage:
+        valid &= reader.read(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::ArgTSampler:
+        valid &= reader.read(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::ArgTValue: {
+        uint32_t numElements = 0u;
+        valid &= reader.read(numElements);
+        auto &elements = arg.as<ArgDescValue>().elements;
+        for (uint32_t i = 0; valid && (i < numElements); ++i) {
+            ArgDescValue::Element element;
+            valid &= reader.read(element);
+            elements.push_back(element);
+        }
+        break;
+    }
+    }
+    return valid;
+}
+
+void writeKernelInfo(BlobWriter &writer, const KernelInfo &kernelInfo) {
+    const auto &kd = kernelInfo.kernelDescriptor;
+    writer.write(kd.kernelAttributes);
+    writer.write(kd.entryPoints);
+    writer.write(kd.payloadMappings.dispatchTraits);
+    writer.write(kd.payloadMappings.bindingTable);
+    writer.write(kd.payloadMappings.samplerTable);
+    writer.write(kd.payloadMappings.implicitArgs);
+
+    writer.write(static_cast<uint32_t>(kd.payloadMappings.explicitArgs.size()));
+    for (const auto &arg : kd.payloadMappings.explicitArgs) {
+        writeArgDescriptor(writer, arg);
+    }
+
+    const auto &argsExt = kd.payloadMappings.explicitArgsExtendedDescriptors;
+    writer.write(static_cast<uint32_t>(argsExt.size()));
+    for (const auto &argExt : argsExt) {
+        writer.write(static_cast<uint8_t>(nullptr != argExt));
+        if (nullptr != argExt) {
+            auto &vme = static_cast<const ArgDescVme &>(*argExt);
+            writer.write(vme.mbBlockType);
+            writer.write(vme.subpixelMode);
+            writer.write(vme.sadAdjustMode);
+            writer.write(vme.searchPathType);
+        }
+    }
+
+    writer.write(static_cast<uint32_t>(kd.explicitArgsExtendedMetadata.size()));
+    for (const auto &argMetadata : kd.explicitArgsExtendedMetadata) {
+        writer.write(argMetadata.argName);
+        writer.write(argMetadata.type);
+        writer.write(argMetadata.accessQualifier);
+        writer.write(argMetadata.addressQualifier);
+        writer.write(argMetadata.typeQualifiers);
+    }
+
+    writer.write(kd.kernelMetadata.kernelName);
+    writer.write(kd.kernelMetadata.kernelLanguageAttributes);
+    writer.write(static_cast<uint32_t>(kd.kernelMetadata.printfStringsMap.size()));
+    for (const auto &printfString : kd.kernelMetadata.printfStringsMap) {
+        writer.write(printfString.first);
+        writer.write(printfString.second);
+    }
+    writer.write(static_cast<uint32_t>(kd.kernelMetadata.allByValueKernelArguments.size()));
+    for (const auto &byValueArg : kd.kernelMetadata.allByValueKernelArguments) {
+        writer.write(byValueArg);
+    }
+    writer.write(kd.kernelMetadata.compiledSubGroupsNumber);
+    writer.write(kd.kernelMetadata.requiredSubGroupSize);
+
+    writer.write(static_cast<uint32_t>(kd.generatedHeaps.size()));
+    writer.writeBytes(kd.generatedHeaps.data(), kd.generatedHeaps.size());
+
+    auto heapsBase = reinterpret_cast<uintptr_t>(kd.generatedHeaps.data());
+    auto getHeapOffset = [heapsBase, &kd](const void *heap) {
+        return (nullptr == heap) ? static_cast<uint32_t>(kd.generatedHeaps.size()) : static_cast<uint32_t>(reinterpret_cast<uintptr_t>(heap) - heapsBase);
+    };
+    writer.write(getHeapOffset(kernelInfo.heapInfo.pSsh));
+    writer.write(kernelInfo.heapInfo.SurfaceStateHeapSize);
+    writer.write(getHeapOffset(kernelInfo.heapInfo.pDsh));
+    writer.write(kernelInfo.heapInfo.DynamicStateHeapSize);
+}
+
+bool readKernelInfo(BlobReader &reader, KernelInfo &kernelInfo) {
+    auto &kd = kernelInfo.kernelDescriptor;
+    bool valid = reader.read(kd.kernelAttributes);
+    valid &= reader.read(kd.entryPoints);
+    valid &= reader.read(kd.payloadMappings.dispatchTraits);
+    valid &= reader.read(kd.payloadMappings.bindingTable);
+    valid &= reader.read(kd.payloadMappings.samplerTable);
+    valid &= reader.read(kd.payloadMappings.implicitArgs);
+
+    uint32_t numExplicitArgs = 0u;
+    valid &= reader.read(numExplicitArgs);
+    for (uint32_t i = 0; valid && (i < numExplicitArgs); ++i) {
+        ArgDescriptor arg;
+        valid &= readArgDescriptor(reader, arg);
+        kd.payloadMappings.explicitArgs.push_back(arg);
+    }
+
+    uint32_t numArgsExt = 0u;
+    valid &= reader.read(numArgsExt);
+    valid &= (numArgsExt <= reader.getRemainingSize());
+    if (valid) {
+        kd.payloadMappings.explicitArgsExtendedDescriptors.resize(numArgsExt);
+    }
+    for (uint32_t i = 0; valid && (i < numArgsExt); ++i) {
+        uint8_t hasArgExt = 0u;
+        valid &= reader.read(hasArgExt);
+        if (valid && (0u != hasArgExt)) {
+            auto vme = std::make_unique<ArgDescVme>();
+            valid &= reader.read(vme->mbBlockType);
+            valid &= reader.read(vme->subpixelMode);
+            valid &= reader.read(vme->sadAdjustMode);
+            valid &= reader.read(vme->searchPathType);
+            kd.payloadMappings.explicitArgsExtendedDescriptors[i] = std::move(vme);
+        }
+    }
+
+    uint32_t numArgsMetadata = 0u;
+    valid &= reader.read(numArgsMetadata);
+    valid &= (numArgsMetadata <= reader.getRemainingSize());
+    if (valid) {
+        kd.explicitArgsExtendedMetadata.resize(numArgsMetadata);
+    }
+    for (uint32_t i = 0; valid && (i < numArgsMetadata); ++i) {
+        auto &argMetadata = kd.explicitArgsExtendedMetadata[i];
+        valid &= reader.read(argMetadata.argName);
+        valid &= reader.read(argMetadata.type);
+        valid &= reader.read(argMetadata.accessQualifier);
+        valid &= reader.read(argMetadata.addressQualifier);
+        valid &= reader.read(argMetadata.typeQualifiers);
+    }
+
+    valid &= reader.read(kd.kernelMetadata.kernelName);
+    valid &= reader.read(kd.kernelMetadata.kernelLanguageAttributes);
+    uint32_t numPrintfStrings = 0u;
+    valid &= reader.read(numPrintfStrings);
+    for (uint32_t i = 0; valid && (i < numPrintfStrings); ++i) {
+        uint32_t index = 0u;
+        std::string printfString;
+        valid &= reader.read(index);
+        valid &= reader.read(printfString);
+        kd.kernelMetadata.printfStringsMap[index] = std::move(printfString);
+    }
+    uint32_t numByValueArgs = 0u;
+    valid &= reader.read(numByValueArgs);
+    for (uint32_t i = 0; valid && (i < numByValueArgs); ++i) {
+        decltype(kd.kernelMetadata)::ByValueArgument byValueArg;
+        valid &= reader.read(byValueArg);
+        kd.kernelMetadata.allByValueKernelArguments.push_back(byValueArg);
+    }
+    valid &= reader.read(kd.kernelMetadata.compiledSubGroupsNumber);
+    valid &= reader.read(kd.kernelMetadata.requiredSubGroupSize);
+
+    uint32_t generatedHeapsSize = 0u;
+    valid &= reader.read(generatedHeapsSize);
+    valid &= (generatedHeapsSize <= reader.getRemainingSize());
+    if (false == valid) {
+        return false;
+    }
+    kd.generatedHeaps.resize(generatedHeapsSize);
+    valid &= reader.readBytes(kd.generatedHeaps.data(), generatedHeapsSize);
+
+    uint32_t sshOffset = 0u;
+    uint32_t dshOffset = 0u;
+    auto &heapInfo = kernelInfo.heapInfo;
+    valid &= reader.read(sshOffset);
+    valid &= reader.read(heapInfo.SurfaceStateHeapSize);
+    valid &= reader.read(dshOffset);
+    valid &= reader.read(heapInfo.DynamicStateHeapSize);
+    valid &= (static_cast<uint64_t>(sshOffset) + heapInfo.SurfaceStateHeapSize <= generatedHeapsSize);
+    valid &= (static_cast<uint64_t>(dshOffset) + heapInfo.DynamicStateHeapSize <= generatedHeapsSize);
+    if (false == valid) {
+        return false;
+    }
+    heapInfo.pSsh = kd.generatedHeaps.data() + sshOffset;
+    heapInfo.pDsh = kd.generatedHeaps.data() + dshOffset;
+    return true;
+}
+
+ZeInfoBlobHeader createHeader(const ProgramInfo &programInfo, ArrayRef<const uint8_t> zeInfo) {
+    ZeInfoBlobHeader header;
+    header.layoutId = getLayoutId();
+    header.decoderVersionMajor = zeInfoDecoderVersion.major;
+    header.decoderVersionMinor = zeInfoDecoderVersion.minor;
+    header.grfSize = programInfo.grfSize;
+    header.minScratchSpaceSize = programInfo.minScratchSpaceSize;
+    header.appendElws = DebugManager.flags.ZebinAppendElws.get() ? 1u : 0u;
+    header.driverBuildId = getDriverBuildId();
+    header.zeInfoHash = Hash128::hash(reinterpret_cast<const char *>(zeInfo.begin()), zeInfo.size());
+    return header;
+}
+
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+std::vector<uint8_t> createZeInfoBlobFromZebin(ArrayRef<const uint8_t> zebin, const TargetDevice &targetDevice) {
+    std::string errors;
+    std::string warnings;
+    auto elf = Elf::decodeElf<numBits>(zebin, errors, warnings);
+    if ((nullptr == elf.elfFileHeader) || (false == elf.programHeaders.empty())) {
+        return {};
+    }
+
+    ZebinSections<numBits> zebinSections;
+    if (DecodeError::Success != extractZebinSections(elf, zebinSections, errors, warnings)) {
+        return {};
+    }
+    if (zebinSections.zeInfoSections.empty()) {
+        return {};
+    }
+
+    if (DecodeError::Success != validateZebinSectionsCount(zebinSections, errors, warnings)) {
+        return {};
+    }
+
+    ProgramInfo programInfo;
+    programInfo.grfSize = targetDevice.grfSize;
+    programInfo.minScratchSpaceSize = targetDevice.minScratchSpaceSize;
+    Elf::ZebinKernelMetadata::Types::Version zeInfoVersion;
+    std::string zeInfoWarnings;
+    if (DecodeError::Success != decodeZeInfo(programInfo, elf, zebinSections, zeInfoVersion, errors, zeInfoWarnings)) {
+        return {};
+    }
+    return serializeZeInfoBlob(programInfo, zebinSections.zeInfoSections[0]->data, zeInfoVersion, zeInfoWarnings);
+}
+
+} // namespace
+
+std::vector<uint8_t> createZeInfoBlob(ArrayRef<const uint8_t> zebin, const TargetDevice &targetDevice) {
+    if (false == isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(zebin)) {
+        return {};
+    }
+    if (Elf::isElf<Elf::EI_CLASS_32>(zebin)) {
+        return createZeInfoBlobFromZebin<Elf::EI_CLASS_32>(zebin, targetDevice);
+    }
+    return createZeInfoBlobFromZebin<Elf::EI_CLASS_64>(zebin, targetDevice);
+}
+
+std::vector<uint8_t> serializeZeInfoBlob(const ProgramInfo &programInfo, ArrayRef<const uint8_t> zeInfo,
+                                         const Elf::ZebinKernelMetadata::Types::Version &zeInfoVersion, const std::string &zeInfoWarnings) {
+    BlobWriter writer;
+    writer.write(createHeader(programInfo, zeInfo));
+    writer.write(zeInfoVersion.major);
+    writer.write(zeInfoVersion.minor);
+    writer.write(zeInfoWarnings);
+
+    writer.write(static_cast<uint32_t>(programInfo.kernelInfos.size()));
+    for (const auto kernelInfo : programInfo.kernelInfos) {
+        writeKernelInfo(writer, *kernelInfo);
+    }
+
+    writer.write(static_cast<uint32_t>(programInfo.externalFunctions.size()));
+    for (const auto &externalFunction : programInfo.externalFunctions) {
+        writer.write(externalFunction.functionName);
+        writer.write(externalFunction.barrierCount);
+        writer.write(externalFunction.numGrfRequired);
+        writer.write(externalFunction.simdSize);
+    }
+
+    writer.write(static_cast<uint32_t>(programInfo.globalsDeviceToHostNameMap.size()));
+    for (const auto &nameMapping : programInfo.globalsDeviceToHostNameMap) {
+        writer.write(nameMapping.first);
+        writer.write(nameMapping.second);
+    }
+
+    auto payloadSize = writer.data.size() - sizeof(ZeInfoBlobHeader);
+    memcpy(writer.data.data() + offsetof(ZeInfoBlobHeader, payloadSize), &payloadSize, sizeof(ZeInfoBlobHeader::payloadSize));
+    return std::move(writer.data);
+}
+
+bool deserializeZeInfoBlob(ZeInfoBlobContent &out, ArrayRef<const uint8_t> blob, ArrayRef<const uint8_t> zeInfo, const ProgramInfo &programInfo) {
+    BlobReader reader(blob);
+    ZeInfoBlobHeader header;
+    if (false == reader.read(header)) {
+        return false;
+    }
+
+    auto expectedHeader = createHeader(programInfo, zeInfo);
+    bool upToDate = (header.headerMagic == expectedHeader.headerMagic);
+    upToDate &= (header.version == expectedHeader.version);
+    upToDate &= (header.layoutId == expectedHeader.layoutId);
+    upToDate &= (header.decoderVersionMajor == expectedHeader.decoderVersionMajor);
+    upToDate &= (header.decoderVersionMinor == expectedHeader.decoderVersionMinor);
+    upToDate &= (header.grfSize == expectedHeader.grfSize);
+    upToDate &= (header.minScratchSpaceSize == expectedHeader.minScratchSpaceSize);
+    upToDate &= (header.appendElws == expectedHeader.appendElws);
+    upToDate &= (header.driverBuildId == expectedHeader.driverBuildId);
+    upToDate &= (header.zeInfoHash == expectedHeader.zeInfoHash);
+    upToDate &= (header.payloadSize == reader.getRemainingSize());
+    if (false == upToDate) {
+        return false;
+    }
+
+    ZeInfoBlobContent content;
+    bool valid = reader.read(content.zeInfoVersion.major);
+    valid &= reader.read(content.zeInfoVersion.minor);
+    valid &= reader.read(content.zeInfoWarnings);
+
+    uint32_t numKernels = 0u;
+    valid &= reader.read(numKernels);
+    for (uint32_t i = 0; valid && (i < numKernels); ++i) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        valid &= readKernelInfo(reader, *kernelInfo);
+        content.kernelInfos.push_back(std::move(kernelInfo));
+    }
+
+    uint32_t numExternalFunctions = 0u;
+    valid &= reader.read(numExternalFunctions);
+    for (uint32_t i = 0; valid && (i < numExternalFunctions); ++i) {
+        ExternalFunctionInfo externalFunction;
+        valid &= reader.read(externalFunction.functionName);
+        valid &= reader.read(externalFunction.barrierCount);
+        valid &= reader.read(externalFunction.numGrfRequired);
+        valid &= reader.read(externalFunction.simdSize);
+        content.externalFunctions.push_back(std::move(externalFunction));
+    }
+
+    uint32_t numNameMappings = 0u;
+    valid &= reader.read(numNameMappings);
+    for (uint32_t i = 0; valid && (i < numNameMappings); ++i) {
+        std::string deviceName;
+        std::string hostName;
+        valid &= reader.read(deviceName);
+        valid &= reader.read(hostName);
+        content.globalsDeviceToHostNameMap[std::move(deviceName)] = std::move(hostName);
+    }
+
+    if ((false == valid) || (0u != reader.getRemainingSize())) {
+        return false;
+    }
+
+    out = std::move(content);
+    return true;
+}
+
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/device_binary_format/elf/zebin_elf.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+struct KernelInfo;
+struct ProgramInfo;
+struct TargetDevice;
+
+// Pre-decoded form of .ze_info - lets decodeZebin skip YAML parsing when the blob was generated
+// by the same driver build from identical .ze_info and with identical decoder inputs.
+// Blob is never part of zebin - it is stored by compiler cache next to the cached zebin and
+// decoder uses it only when it is explicitly passed along with the device binary.
+struct ZeInfoBlobHeader {
+    static constexpr uint32_t magic = 0x4249455a; // "ZEIB"
+    static constexpr uint32_t currentVersion = 3u;
+
+    uint32_t headerMagic = magic;
+    uint32_t version = currentVersion;
+    uint32_t layoutId = 0u;
+    uint32_t decoderVersionMajor = 0u;
+    uint32_t decoderVersionMinor = 0u;
+    uint32_t grfSize = 0u;
+    uint32_t minScratchSpaceSize = 0u;
+    uint32_t appendElws = 0u;
+    uint64_t driverBuildId = 0u;
+    Hash128Value zeInfoHash;
+    uint64_t payloadSize = 0u;
+};
+static_assert(sizeof(ZeInfoBlobHeader) == 64u, "ZeInfo blob header is part of binary format");
+
+struct ZeInfoBlobContent {
+    Elf::ZebinKernelMetadata::Types::Version zeInfoVersion;
+    std::string zeInfoWarnings;
+    std::vector<std::unique_ptr<KernelInfo>> kernelInfos;
+    std::vector<ExternalFunctionInfo> externalFunctions;
+    std::unordered_map<std::string, std::string> globalsDeviceToHostNameMap;
+};
+
+// Compiler cache stores blob of a cached zebin under the zebin's key extended with this suffix
+constexpr ConstStringRef zeInfoBlobCacheKeySuffix = ".zeinfo";
+
+// Returns blob generated from .ze_info of given zebin for given target device.
+// Returns empty vector if input is not a decodable zebin.
+std::vector<uint8_t> createZeInfoBlob(ArrayRef<const uint8_t> zebin, const TargetDevice &targetDevice);
+
+// zeInfoVersion and zeInfoWarnings are the ones reported while decoding .ze_info - they are
+// stored in the blob so that version is validated and warnings are reported also when blob is used.
+std::vector<uint8_t> serializeZeInfoBlob(const ProgramInfo &programInfo, ArrayRef<const uint8_t> zeInfo,
+                                         const Elf::ZebinKernelMetadata::Types::Version &zeInfoVersion, const std::string &zeInfoWarnings);
+
+// Returns false if blob is malformed or stale (i.e. was not generated from given .ze_info with
+// decoder inputs matching programInfo) - caller is expected to fall back to parsing .ze_info.
+// Kernel heaps are not restored - only generated SSH/DSH are bound within heapInfo.
+bool deserializeZeInfoBlob(ZeInfoBlobContent &out, ArrayRef<const uint8_t> blob, ArrayRef<const uint8_t> zeInfo, const ProgramInfo &programInfo);
+
+} // namespace NEO
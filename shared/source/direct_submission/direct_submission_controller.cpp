@@ -8,6 +8,7 @@
 #include "shared/source/direct_submission/direct_submission_controller.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 
@@ -22,22 +23,26 @@ DirectSubmissionController::DirectSubmissionController() {
     if (DebugManager.flags.DirectSubmissionControllerDivisor.get() != -1) {
         timeoutDivisor = DebugManager.flags.DirectSubmissionControllerDivisor.get();
     }
+    if (DebugManager.flags.DirectSubmissionControllerMaxTimeout.get() != -1) {
+        maxTimeout = DebugManager.flags.DirectSubmissionControllerMaxTimeout.get();
+    }
 
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
-    keepControlling.store(false);
-    if (directSubmissionControllingThread) {
-        directSubmissionControllingThread->join();
-        directSubmissionControllingThread.reset();
-    }
+    stopControlling();
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDirectSubmissionControllerStatistics.get(), stdout,
+                       "Direct submission controller ring stops/restarts: %llu/%llu\n", static_cast<unsigned long long>(ringStopCount), static_cast<unsigned long long>(ringRestartCount));
 }
 
 void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver *csr) {
-    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
-    directSubmissions.insert(std::make_pair(csr, DirectSubmissionState{}));
-    this->adjustTimeout(csr);
+    {
+        std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+        directSubmissions.insert(std::make_pair(csr, DirectSubmissionState{}));
+        this->adjustTimeout(csr);
+    }
+    this->notifyActivity();
 }
 
 void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceiver *csr) {
@@ -47,6 +52,27 @@ void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceive
 
 void DirectSubmissionController::startControlling() {
     this->runControlling.store(true);
+    this->notifyActivity();
+}
+
+void DirectSubmissionController::stopControlling() {
+    {
+        std::lock_guard<std::mutex> lock(this->condVarMutex);
+        this->keepControlling.store(false);
+    }
+    this->condVar.notify_all();
+    if (directSubmissionControllingThread) {
+        directSubmissionControllingThread->join();
+        directSubmissionControllingThread.reset();
+    }
+}
+
+void DirectSubmissionController::notifyActivity() {
+    this->activityCounter++;
+    if (this->isWaitingForActivity.load()) {
+        std::lock_guard<std::mutex> lock(this->condVarMutex);
+        this->condVar.notify_all();
+    }
 }
 
 void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
@@ -72,6 +98,8 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
 
 void DirectSubmissionController::checkNewSubmissions() {
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    const auto currentTime = this->getCpuTimestamp();
+    this->activeDirectSubmissionsCount = 0u;
 
     for (auto &directSubmission : this->directSubmissions) {
         auto csr = directSubmission.first;
@@ -81,20 +109,60 @@ void DirectSubmissionController::checkNewSubmissions() {
         if (taskCount == state.taskCount) {
             if (state.isStopped) {
                 continue;
-            } else {
-                auto lock = csr->obtainUniqueOwnership();
-                csr->stopDirectSubmission();
-                state.isStopped = true;
             }
+            const auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - state.lastSubmissionTime).count();
+            if (idleTime < this->getIdleTimeToStop(state)) {
+                this->activeDirectSubmissionsCount++;
+                continue;
+            }
+            auto lock = csr->obtainUniqueOwnership();
+            csr->stopDirectSubmission();
+            state.isStopped = true;
+            state.isStoppedByController = true;
+            this->ringStopCount++;
         } else {
+            if (state.isStoppedByController) {
+                state.isStoppedByController = false;
+                this->ringRestartCount++;
+            }
+            this->updatePredictedIdleTime(state, currentTime);
             state.isStopped = false;
             state.taskCount = taskCount;
+            this->activeDirectSubmissionsCount++;
         }
     }
 }
 
+void DirectSubmissionController::updatePredictedIdleTime(DirectSubmissionState &state, SteadyClock::time_point currentTime) {
+    if (state.taskCount != 0u) {
+        const auto gap = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - state.lastSubmissionTime).count();
+        state.predictedIdleTime = (state.predictedIdleTime == -1) ? gap : (gap + 3 * state.predictedIdleTime) / 4;
+    }
+    state.lastSubmissionTime = currentTime;
+}
+
+int64_t DirectSubmissionController::getIdleTimeToStop(const DirectSubmissionState &state) const {
+    // Keep ring running through gaps shorter than maxTimeout, so that bursty submissions
+    // do not pay for ring restart. Longer or unknown gaps stop the ring after single idle period.
+    if (state.predictedIdleTime > this->timeout && state.predictedIdleTime <= this->maxTimeout) {
+        return state.predictedIdleTime + this->timeout;
+    }
+    return 0;
+}
+
 void DirectSubmissionController::sleep() {
-    std::this_thread::sleep_for(std::chrono::microseconds(this->timeout));
+    std::unique_lock<std::mutex> lock(this->condVarMutex);
+    if (!this->runControlling.load() || this->activeDirectSubmissionsCount == 0u) {
+        this->isWaitingForActivity.store(true);
+        this->condVar.wait(lock, [&]() { return !this->keepControlling.load() || this->activityCounter.load() != this->lastSeenActivity; });
+        this->isWaitingForActivity.store(false);
+        this->lastSeenActivity = this->activityCounter.load();
+    }
+    this->condVar.wait_for(lock, std::chrono::microseconds(this->timeout), [&]() { return !this->keepControlling.load(); });
+}
+
+DirectSubmissionController::SteadyClock::time_point DirectSubmissionController::getCpuTimestamp() {
+    return SteadyClock::now();
 }
 
 void DirectSubmissionController::adjustTimeout(CommandStreamReceiver *csr) {
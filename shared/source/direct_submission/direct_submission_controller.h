@@ -11,6 +11,8 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -32,16 +34,29 @@ class DirectSubmissionController {
 
     static bool isSupported();
 
+    uint64_t getRingStopCount() const { return ringStopCount; }
+    uint64_t getRingRestartCount() const { return ringRestartCount; }
+
   protected:
+    using SteadyClock = std::chrono::steady_clock;
+
     struct DirectSubmissionState {
         bool isStopped = true;
+        bool isStoppedByController = false;
         uint32_t taskCount = 0u;
+        SteadyClock::time_point lastSubmissionTime{};
+        int64_t predictedIdleTime = -1; // us, EWMA of gaps between observed submissions, -1 - not known yet
     };
 
     static void *controlDirectSubmissionsState(void *self);
     void checkNewSubmissions();
     MOCKABLE_VIRTUAL void sleep();
+    MOCKABLE_VIRTUAL SteadyClock::time_point getCpuTimestamp();
+    void stopControlling();
+    void notifyActivity();
 
+    void updatePredictedIdleTime(DirectSubmissionState &state, SteadyClock::time_point currentTime);
+    int64_t getIdleTimeToStop(const DirectSubmissionState &state) const;
     void adjustTimeout(CommandStreamReceiver *csr);
 
     uint32_t maxCcsCount = 1u;
@@ -53,7 +68,19 @@ class DirectSubmissionController {
     std::atomic_bool keepControlling = true;
     std::atomic_bool runControlling = false;
 
+    // Controlling thread blocks on condVar when no ring is running, submissions wake it up
+    std::mutex condVarMutex;
+    std::condition_variable condVar;
+    std::atomic<uint64_t> activityCounter{0u};
+    std::atomic_bool isWaitingForActivity = false;
+    uint64_t lastSeenActivity = 0u;
+    uint32_t activeDirectSubmissionsCount = 0u;
+
+    uint64_t ringStopCount = 0u;
+    uint64_t ringRestartCount = 0u;
+
     int timeout = 5000;
     int timeoutDivisor = 1;
+    int maxTimeout = 20000;
 };
 } // namespace NEO
\ No newline at end of file
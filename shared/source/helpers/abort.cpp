@@ -7,10 +7,22 @@
 
 #include "shared/source/helpers/abort.h"
 
+#include <atomic>
 #include <cstdlib>
 
 namespace NEO {
+static std::atomic<AbortExecutionHandler> abortExecutionHandler{nullptr};
+
+void setAbortExecutionHandler(AbortExecutionHandler handler) {
+    abortExecutionHandler.store(handler);
+}
+
 void abortExecution() {
+    // handler is taken out first, so abort hit inside of it doesn't recurse
+    auto handler = abortExecutionHandler.exchange(nullptr);
+    if (handler) {
+        handler();
+    }
     abort();
 }
 } // namespace NEO
@@ -9,4 +9,8 @@
 
 namespace NEO {
 [[noreturn]] void abortExecution();
-}
+
+// Handler is called by abortExecution before process is terminated, e.g. to persist buffered debug captures
+using AbortExecutionHandler = void (*)();
+void setAbortExecutionHandler(AbortExecutionHandler handler);
+} // namespace NEO
@@ -18,6 +18,7 @@ struct ApiSpecificConfig {
     static bool getHeapConfiguration();
     static bool getBindlessConfiguration();
     static bool isDeviceAllocationCacheEnabled();
+    static bool isHostAllocationCacheEnabled();
     static ApiType getApiType();
     static std::string getName();
     static uint64_t getReducedMaxAllocSize(uint64_t maxAllocSize);
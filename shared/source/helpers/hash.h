@@ -8,6 +8,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 // clang-format off
@@ -104,6 +105,180 @@ class Hash {
     uint32_t a, hi, lo;
 };
 
+struct Hash128Value {
+    uint64_t low = 0u;
+    uint64_t high = 0u;
+
+    bool operator==(const Hash128Value &rhs) const {
+        return (low == rhs.low) && (high == rhs.high);
+    }
+    bool operator!=(const Hash128Value &rhs) const {
+        return false == (*this == rhs);
+    }
+};
+
+// Streaming 128-bit hash for large inputs (e.g. compiler cache keys).
+// Input is consumed in 32-byte stripes by 4 independent 64-bit lanes, which keeps
+// the multiplies pipelined instead of serializing on a single state word as Hash does.
+class Hash128 {
+  public:
+    static constexpr size_t stripeSize = 32u;
+
+    Hash128() {
+        reset();
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr) {
+            return;
+        }
+        auto input = reinterpret_cast<const uint8_t *>(buff);
+        totalSize += size;
+
+        if (bufferedSize > 0u) {
+            auto toCopy = stripeSize - bufferedSize;
+            if (size < toCopy) {
+                memcpy(buffer + bufferedSize, input, size);
+                bufferedSize += size;
+                return;
+            }
+            memcpy(buffer + bufferedSize, input, toCopy);
+            consumeStripe(buffer);
+            bufferedSize = 0u;
+            input += toCopy;
+            size -= toCopy;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(input);
+            input += stripeSize;
+            size -= stripeSize;
+        }
+
+        if (size > 0u) {
+            memcpy(buffer, input, size);
+            bufferedSize = size;
+        }
+    }
+
+    Hash128Value finish() const {
+        Hash128Value ret;
+        uint64_t low = 0u;
+        uint64_t high = 0u;
+        if (totalSize >= stripeSize) {
+            low = rotl(acc[0], 1) + rotl(acc[1], 7) + rotl(acc[2], 12) + rotl(acc[3], 18);
+            high = rotl(acc[3], 3) ^ rotl(acc[2], 17) ^ rotl(acc[1], 29) ^ rotl(acc[0], 43);
+            for (auto lane : acc) {
+                low = mergeLane(low, lane);
+                high = mergeLane(high, rotl(lane, 32));
+            }
+        } else {
+            low = acc[2] + prime5;
+            high = acc[3] + prime3;
+        }
+        low += totalSize;
+        high ^= totalSize * prime2;
+
+        ret.low = finishTail(low, prime1);
+        ret.high = finishTail(high, prime4);
+        return ret;
+    }
+
+    void reset() {
+        acc[0] = prime1 + prime2;
+        acc[1] = prime2;
+        acc[2] = 0u;
+        acc[3] = 0u - prime1;
+        bufferedSize = 0u;
+        totalSize = 0u;
+    }
+
+    static Hash128Value hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    static uint64_t rotl(uint64_t value, uint32_t shift) {
+        return (value << shift) | (value >> (64u - shift));
+    }
+
+    static uint64_t read64(const uint8_t *ptr) {
+        uint64_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static uint32_t read32(const uint8_t *ptr) {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    static uint64_t accumulate(uint64_t lane, uint64_t input) {
+        lane += input * prime2;
+        lane = rotl(lane, 31);
+        return lane * prime1;
+    }
+
+    static uint64_t mergeLane(uint64_t value, uint64_t lane) {
+        value ^= accumulate(0u, lane);
+        return value * prime1 + prime4;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 33;
+        value *= prime2;
+        value ^= value >> 29;
+        value *= prime3;
+        value ^= value >> 32;
+        return value;
+    }
+
+    void consumeStripe(const uint8_t *stripe) {
+        acc[0] = accumulate(acc[0], read64(stripe));
+        acc[1] = accumulate(acc[1], read64(stripe + 8));
+        acc[2] = accumulate(acc[2], read64(stripe + 16));
+        acc[3] = accumulate(acc[3], read64(stripe + 24));
+    }
+
+    uint64_t finishTail(uint64_t value, uint64_t tailPrime) const {
+        const uint8_t *tail = buffer;
+        size_t size = bufferedSize;
+        while (size >= sizeof(uint64_t)) {
+            value ^= accumulate(0u, read64(tail));
+            value = rotl(value, 27) * tailPrime + prime4;
+            tail += sizeof(uint64_t);
+            size -= sizeof(uint64_t);
+        }
+        if (size >= sizeof(uint32_t)) {
+            value ^= static_cast<uint64_t>(read32(tail)) * prime1;
+            value = rotl(value, 23) * prime2 + prime3;
+            tail += sizeof(uint32_t);
+            size -= sizeof(uint32_t);
+        }
+        while (size > 0u) {
+            value ^= (*tail) * prime5;
+            value = rotl(value, 11) * tailPrime;
+            tail++;
+            size--;
+        }
+        return avalanche(value);
+    }
+
+    uint64_t acc[4];
+    uint8_t buffer[stripeSize];
+    size_t bufferedSize;
+    uint64_t totalSize;
+};
+
 template <typename T>
 uint32_t hashPtrToU32(const T *src) {
     auto asInt = reinterpret_cast<uintptr_t>(src);
@@ -8,6 +8,9 @@
 #include "shared/source/memory_manager/allocations_list.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
 
 namespace {
 struct ReusableAllocationRequirements {
@@ -48,7 +51,12 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
     req.activeTileCount = (commandStreamReceiver == nullptr) ? 1u : commandStreamReceiver->getActivePartitions();
     req.tagOffset = (commandStreamReceiver == nullptr) ? 0u : commandStreamReceiver->getPostSyncWriteOffset();
     GraphicsAllocation *a = nullptr;
-    GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    GraphicsAllocation *retAlloc = nullptr;
+    if (isReuseIndexEnabled() && requiredPtr == nullptr) {
+        retAlloc = processLocked<AllocationsList, &AllocationsList::detachIndexedAllocationImpl>(a, static_cast<void *>(&req));
+    } else {
+        retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    }
     return std::unique_ptr<GraphicsAllocation>(retAlloc);
 }
 
@@ -59,7 +67,7 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
         if ((req->allocationType == curr->getAllocationType()) &&
             (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize)) {
             if (req->csrTagAddress == nullptr) {
-                return removeOneImpl(curr, nullptr);
+                return removeOneIndexedImpl(curr, nullptr);
             }
             if ((this->allocationUsage == TEMPORARY_ALLOCATION || checkTagAddressReady(req, curr)) &&
                 (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
@@ -67,7 +75,7 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
                     // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
                     curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
                 }
-                return removeOneImpl(curr, nullptr);
+                return removeOneIndexedImpl(curr, nullptr);
             }
         }
         curr = curr->next;
@@ -75,6 +83,28 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     return nullptr;
 }
 
+GraphicsAllocation *AllocationsList::detachIndexedAllocationImpl(GraphicsAllocation *, void *data) {
+    ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
+    const auto requiredSizeClass = getSizeClass(req->requiredMinimalSize);
+    for (auto bucket = reuseIndex.lower_bound({req->allocationType, requiredSizeClass});
+         bucket != reuseIndex.end() && bucket->first.first == req->allocationType; ++bucket) {
+        auto &allocations = bucket->second;
+        for (auto it = allocations.begin(); it != allocations.end(); ++it) {
+            auto allocation = *it;
+            if (allocation->getUnderlyingBufferSize() < req->requiredMinimalSize) {
+                continue;
+            }
+            if (req->csrTagAddress != nullptr && !checkTagAddressReady(req, allocation)) {
+                // sublist is in completion order, following allocations are not ready either
+                break;
+            }
+            allocations.erase(it);
+            return removeOneImpl(allocation, nullptr);
+        }
+    }
+    return nullptr;
+}
+
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
     auto *curr = head;
     while (curr != nullptr) {
@@ -83,5 +113,137 @@ void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
         curr = currNext;
     }
     head = nullptr;
+    tail = nullptr;
+    clearReuseIndex();
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneIndexedImpl>(&node);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneIndexedImpl>(&node);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &node) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneIndexedImpl>(&node));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneIndexedImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceIndexedImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesIndexedImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &nodes) {
+    processLocked<AllocationsList, &AllocationsList::spliceIndexedImpl>(&nodes);
+}
+
+void AllocationsList::deleteAll() {
+    GraphicsAllocation *nodes = detachNodes();
+    if (nodes != nullptr) {
+        nodes->deleteThisAndAllNext();
+    }
+}
+
+uint32_t AllocationsList::getSizeClass(size_t size) {
+    return (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
+AllocationsList::ReuseIndexKey AllocationsList::getReuseIndexKey(const GraphicsAllocation *allocation) {
+    return {allocation->getAllocationType(), getSizeClass(allocation->getUnderlyingBufferSize())};
+}
+
+void AllocationsList::addToReuseIndex(GraphicsAllocation *allocation) {
+    if (isReuseIndexEnabled()) {
+        reuseIndex[getReuseIndexKey(allocation)].push_back(allocation);
+    }
+}
+
+void AllocationsList::clearReuseIndex() {
+    // keep buckets, reusable lists are refilled with the same kinds of allocations
+    for (auto &bucket : reuseIndex) {
+        bucket.second.clear();
+    }
+}
+
+void AllocationsList::removeFromReuseIndex(GraphicsAllocation *allocation) {
+    if (!isReuseIndexEnabled()) {
+        return;
+    }
+    auto bucket = reuseIndex.find(getReuseIndexKey(allocation));
+    if (bucket != reuseIndex.end()) {
+        auto &allocations = bucket->second;
+        auto it = std::find(allocations.begin(), allocations.end(), allocation);
+        if (it != allocations.end()) {
+            allocations.erase(it);
+            return;
+        }
+    }
+    // type or size changed after allocation was stored
+    for (auto &anyBucket : reuseIndex) {
+        auto &allocations = anyBucket.second;
+        auto it = std::find(allocations.begin(), allocations.end(), allocation);
+        if (it != allocations.end()) {
+            allocations.erase(it);
+            return;
+        }
+    }
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneIndexedImpl(GraphicsAllocation *node, void *) {
+    pushFrontOneImpl(node, nullptr);
+    if (isReuseIndexEnabled()) {
+        reuseIndex[getReuseIndexKey(node)].push_front(node);
+    }
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneIndexedImpl(GraphicsAllocation *node, void *) {
+    pushTailOneImpl(node, nullptr);
+    addToReuseIndex(node);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::removeOneIndexedImpl(GraphicsAllocation *node, void *) {
+    removeFromReuseIndex(node);
+    return removeOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneIndexedImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneIndexedImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceIndexedImpl(GraphicsAllocation *node, void *data) {
+    auto last = static_cast<GraphicsAllocation *>(data);
+    for (auto curr = node; curr != nullptr; curr = curr->next) {
+        removeFromReuseIndex(curr);
+        if (curr == last) {
+            break;
+        }
+    }
+    return detachSequenceImpl(node, data);
+}
+
+GraphicsAllocation *AllocationsList::detachNodesIndexedImpl(GraphicsAllocation *, void *) {
+    clearReuseIndex();
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceIndexedImpl(GraphicsAllocation *node, void *) {
+    spliceImpl(node, nullptr);
+    for (auto curr = node; curr != nullptr; curr = curr->next) {
+        addToReuseIndex(curr);
+    }
+    return nullptr;
 }
 } // namespace NEO
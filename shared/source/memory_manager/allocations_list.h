@@ -10,7 +10,10 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <deque>
+#include <map>
 #include <memory>
+#include <utility>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -23,9 +26,41 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
 
-  private:
+    // List modifiers below keep reuse index in sync with the list
+    void pushFrontOne(GraphicsAllocation &node);
+    void pushTailOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &nodes);
+    void deleteAll();
+
+    static uint32_t getSizeClass(size_t size);
+
+  protected:
+    // Reusable allocations are additionally indexed by type and power-of-two size class.
+    // Each sublist preserves storing order, which for reusable allocations is also completion order.
+    using ReuseIndexKey = std::pair<AllocationType, uint32_t>;
+    using ReuseIndex = std::map<ReuseIndexKey, std::deque<GraphicsAllocation *>>;
+
+    static ReuseIndexKey getReuseIndexKey(const GraphicsAllocation *allocation);
+    bool isReuseIndexEnabled() const { return allocationUsage == REUSABLE_ALLOCATION; }
+    void addToReuseIndex(GraphicsAllocation *allocation);
+    void removeFromReuseIndex(GraphicsAllocation *allocation);
+    void clearReuseIndex();
+
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachIndexedAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *pushTailOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeFrontOneIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceIndexedImpl(GraphicsAllocation *node, void *data);
+    GraphicsAllocation *detachNodesIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceIndexedImpl(GraphicsAllocation *node, void *);
 
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
+    ReuseIndex reuseIndex;
 };
 } // namespace NEO
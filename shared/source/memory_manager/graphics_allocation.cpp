@@ -14,7 +14,53 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/logger.h"
 
+#include <algorithm>
+
 namespace NEO {
+namespace {
+void setWritableBanks(uint32_t &writableBanks, uint32_t &rangesOnlyBanks, AubInfo::WritableRanges &ranges, bool writable, uint32_t banks) {
+    writableBanks = static_cast<uint32_t>(setBits(writableBanks, writable, banks));
+    rangesOnlyBanks = static_cast<uint32_t>(setBits(rangesOnlyBanks, false, banks));
+    if (rangesOnlyBanks == 0u) {
+        ranges.clear();
+    }
+}
+
+void addWritableRange(uint32_t &writableBanks, uint32_t &rangesOnlyBanks, AubInfo::WritableRanges &ranges, size_t offset, size_t size, uint32_t banks) {
+    // banks that will dump the whole allocation anyway don't need the range
+    auto newRangesOnlyBanks = banks & ~(writableBanks & ~rangesOnlyBanks);
+    if (newRangesOnlyBanks == 0u || size == 0u) {
+        return;
+    }
+    writableBanks |= newRangesOnlyBanks;
+    rangesOnlyBanks |= newRangesOnlyBanks;
+
+    auto rangeStart = alignDown(offset, MemoryConstants::pageSize);
+    auto rangeEnd = alignUp(offset + size, MemoryConstants::pageSize);
+    ranges.emplace_back(rangeStart, rangeEnd - rangeStart);
+    std::sort(ranges.begin(), ranges.end());
+
+    size_t last = 0u;
+    for (size_t i = 1u; i < ranges.size(); i++) {
+        auto lastEnd = ranges[last].first + ranges[last].second;
+        if (ranges[i].first <= lastEnd) {
+            ranges[last].second = std::max(lastEnd, ranges[i].first + ranges[i].second) - ranges[last].first;
+        } else {
+            ranges[++last] = ranges[i];
+        }
+    }
+    ranges.resize(last + 1);
+}
+
+const AubInfo::WritableRanges *getWritableRanges(uint32_t writableBanks, uint32_t rangesOnlyBanks, const AubInfo::WritableRanges &ranges, uint32_t banks) {
+    auto wholeAllocationBanks = writableBanks & ~rangesOnlyBanks & banks;
+    if (wholeAllocationBanks != 0u || !isAnyBitSet(rangesOnlyBanks, banks)) {
+        return nullptr;
+    }
+    return &ranges;
+}
+} // namespace
+
 void GraphicsAllocation::setAllocationType(AllocationType allocationType) {
     this->allocationType = allocationType;
     fileLoggerInstance().logAllocation(this);
@@ -85,7 +131,7 @@ bool GraphicsAllocation::isAllocationLockable() const {
 
 void GraphicsAllocation::setAubWritable(bool writable, uint32_t banks) {
     UNRECOVERABLE_IF(banks == 0);
-    aubInfo.aubWritable = static_cast<uint32_t>(setBits(aubInfo.aubWritable, writable, banks));
+    setWritableBanks(aubInfo.aubWritable, aubInfo.aubWritableRangesOnly, aubInfo.aubWritableRanges, writable, banks);
 }
 
 bool GraphicsAllocation::isAubWritable(uint32_t banks) const {
@@ -94,7 +140,7 @@ bool GraphicsAllocation::isAubWritable(uint32_t banks) const {
 
 void GraphicsAllocation::setTbxWritable(bool writable, uint32_t banks) {
     UNRECOVERABLE_IF(banks == 0);
-    aubInfo.tbxWritable = static_cast<uint32_t>(setBits(aubInfo.tbxWritable, writable, banks));
+    setWritableBanks(aubInfo.tbxWritable, aubInfo.tbxWritableRangesOnly, aubInfo.tbxWritableRanges, writable, banks);
 }
 
 bool GraphicsAllocation::isCompressionEnabled() const {
@@ -105,6 +151,24 @@ bool GraphicsAllocation::isTbxWritable(uint32_t banks) const {
     return isAnyBitSet(aubInfo.tbxWritable, banks);
 }
 
+void GraphicsAllocation::setAubWritableRange(size_t offset, size_t size, uint32_t banks) {
+    UNRECOVERABLE_IF(banks == 0);
+    addWritableRange(aubInfo.aubWritable, aubInfo.aubWritableRangesOnly, aubInfo.aubWritableRanges, offset, size, banks);
+}
+
+const AubInfo::WritableRanges *GraphicsAllocation::getAubWritableRanges(uint32_t banks) const {
+    return getWritableRanges(aubInfo.aubWritable, aubInfo.aubWritableRangesOnly, aubInfo.aubWritableRanges, banks);
+}
+
+void GraphicsAllocation::setTbxWritableRange(size_t offset, size_t size, uint32_t banks) {
+    UNRECOVERABLE_IF(banks == 0);
+    addWritableRange(aubInfo.tbxWritable, aubInfo.tbxWritableRangesOnly, aubInfo.tbxWritableRanges, offset, size, banks);
+}
+
+const AubInfo::WritableRanges *GraphicsAllocation::getTbxWritableRanges(uint32_t banks) const {
+    return getWritableRanges(aubInfo.tbxWritable, aubInfo.tbxWritableRangesOnly, aubInfo.tbxWritableRanges, banks);
+}
+
 void GraphicsAllocation::prepareHostPtrForResidency(CommandStreamReceiver *csr) {
     if (hostPtrTaskCountAssignment > 0) {
         auto allocTaskCount = getTaskCount(csr->getOsContext().getContextId());
@@ -22,6 +22,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 
@@ -42,11 +44,17 @@ class MemoryManager;
 class CommandStreamReceiver;
 
 struct AubInfo {
+    using WritableRanges = std::vector<std::pair<size_t, size_t>>; // sorted, page aligned {offset, size} pairs
+
     uint32_t aubWritable = std::numeric_limits<uint32_t>::max();
     uint32_t tbxWritable = std::numeric_limits<uint32_t>::max();
+    uint32_t aubWritableRangesOnly = 0u;
+    uint32_t tbxWritableRangesOnly = 0u;
     bool allocDumpable = false;
     bool bcsDumpOnly = false;
     bool memObjectsAllocationWithWritableFlags = false;
+    WritableRanges aubWritableRanges;
+    WritableRanges tbxWritableRanges;
 };
 
 class GraphicsAllocation : public IDNode<GraphicsAllocation> {
@@ -130,6 +138,10 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     bool isAubWritable(uint32_t banks) const;
     void setTbxWritable(bool writable, uint32_t banks);
     bool isTbxWritable(uint32_t banks) const;
+    void setAubWritableRange(size_t offset, size_t size, uint32_t banks);
+    const AubInfo::WritableRanges *getAubWritableRanges(uint32_t banks) const;
+    void setTbxWritableRange(size_t offset, size_t size, uint32_t banks);
+    const AubInfo::WritableRanges *getTbxWritableRanges(uint32_t banks) const;
     void setAllocDumpable(bool dumpable, bool bcsDumpOnly) {
         aubInfo.allocDumpable = dumpable;
         aubInfo.bcsDumpOnly = bcsDumpOnly;
@@ -64,6 +64,28 @@ void PTE::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits,
     }
 }
 
+void CoalescingPageWalker::addPage(uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+    bool extendsRange = (rangeSize > 0) &&
+                        (rangePhysAddress + rangeSize == physAddress) &&
+                        (rangeOffset + rangeSize == offset) &&
+                        (rangeEntryBits == entryBits) &&
+                        (rangeSize + size <= maxRangeSize);
+    if (!extendsRange) {
+        flush();
+        rangePhysAddress = physAddress;
+        rangeOffset = offset;
+        rangeEntryBits = entryBits;
+    }
+    rangeSize += size;
+}
+
+void CoalescingPageWalker::flush() {
+    if (rangeSize > 0) {
+        rangeWalker(rangePhysAddress, rangeSize, rangeOffset, rangeEntryBits);
+        rangeSize = 0;
+    }
+}
+
 template class PageTable<class PDP, 3, 9>;
 template class PageTable<class PDE, 2, 2>;
 } // namespace NEO
@@ -84,4 +84,22 @@ class PDPE : public PageTable<class PDE, 2, 2> {
     PDPE(PhysicalAddressAllocator *physicalAddressAllocator) : PageTable<class PDE, 2, 2>(physicalAddressAllocator) {
     }
 };
+
+// Merges pages reported by page walk into ranges that are contiguous both physically and in walked memory,
+// so that target walker is called once per range instead of once per page
+class CoalescingPageWalker {
+  public:
+    CoalescingPageWalker(const PageWalker &rangeWalker, size_t maxRangeSize) : rangeWalker(rangeWalker), maxRangeSize(maxRangeSize) {}
+
+    void addPage(uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits);
+    void flush();
+
+  protected:
+    const PageWalker &rangeWalker;
+    size_t maxRangeSize = 0;
+    uint64_t rangePhysAddress = 0;
+    size_t rangeSize = 0;
+    size_t rangeOffset = 0;
+    uint64_t rangeEntryBits = 0;
+};
 } // namespace NEO
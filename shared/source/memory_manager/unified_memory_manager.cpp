@@ -23,12 +23,93 @@ void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData alloc
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
     SvmAllocationContainer::iterator iter;
     iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    auto removedStart = reinterpret_cast<uintptr_t>(iter->first);
+    auto removedEnd = removedStart + iter->second.size;
     allocations.erase(iter);
+
+    // Removals are serialized by the owner. Reuse of a log slot is announced before it is overwritten,
+    // so lock-free readers can tell the slots they read may be torn, new range is published by removalsCount.
+    auto removals = removalsCount.load(std::memory_order_relaxed);
+    removalsStarted.store(removals + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    auto &removedRange = removedRanges[removals % removedRangesLogSize];
+    removedRange.start.store(removedStart, std::memory_order_relaxed);
+    removedRange.end.store(removedEnd, std::memory_order_relaxed);
+    removalsCount.store(removals + 1, std::memory_order_release);
+}
+
+std::atomic<uint64_t> SVMAllocsManager::MapBasedAllocationTracker::trackersGeneration{1u};
+thread_local SVMAllocsManager::MapBasedAllocationTracker::LookupCache SVMAllocsManager::MapBasedAllocationTracker::lookupCache;
+
+SVMAllocsManager::MapBasedAllocationTracker::~MapBasedAllocationTracker() {
+    trackersGeneration.fetch_add(1u, std::memory_order_release);
+}
+
+size_t SVMAllocsManager::MapBasedAllocationTracker::getLookupCacheSetIndex(uintptr_t address) {
+    // Sets are selected by 64KB granule, so lookups at small offsets from allocation base share an entry
+    auto granule = static_cast<uint64_t>(address / MemoryConstants::pageSize64k);
+    return static_cast<size_t>((granule * 0x9E3779B97F4A7C15ull) >> (64u - LookupCache::numSetsShift));
+}
+
+bool SVMAllocsManager::MapBasedAllocationTracker::isRangeRemovedSince(uint64_t removals, uint64_t currentRemovals, uintptr_t start, uintptr_t end) const {
+    if (currentRemovals - removals > removedRangesLogSize) {
+        return true;
+    }
+    for (auto removal = removals; removal < currentRemovals; removal++) {
+        const auto &removedRange = removedRanges[removal % removedRangesLogSize];
+        if ((removedRange.start.load(std::memory_order_relaxed) < end) && (start < removedRange.end.load(std::memory_order_relaxed))) {
+            return true;
+        }
+    }
+    // Slots read above are valid only if none of them started being reused in the meantime
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return removalsStarted.load(std::memory_order_relaxed) - removals > removedRangesLogSize;
+}
+
+SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::getFromLookupCache(const void *ptr) const {
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    const auto currentTrackersGeneration = trackersGeneration.load(std::memory_order_acquire);
+    for (auto &entry : lookupCache.sets[getLookupCacheSetIndex(address)]) {
+        if ((entry.owner != this) || (address < entry.start) || (address >= entry.end) ||
+            (entry.trackersGeneration != currentTrackersGeneration)) {
+            continue;
+        }
+        const auto currentRemovals = removalsCount.load(std::memory_order_acquire);
+        if (entry.removals != currentRemovals) {
+            if (isRangeRemovedSince(entry.removals, currentRemovals, entry.start, entry.end)) {
+                entry.owner = nullptr;
+                return nullptr;
+            }
+            entry.removals = currentRemovals;
+        }
+        return entry.svmData;
+    }
+    return nullptr;
+}
+
+void SVMAllocsManager::MapBasedAllocationTracker::addToLookupCache(SvmAllocationData *svmData, uintptr_t start, const void *ptr) {
+    auto &set = lookupCache.sets[getLookupCacheSetIndex(reinterpret_cast<uintptr_t>(ptr))];
+    for (auto way = LookupCache::numWays - 1; way > 0; way--) {
+        set[way] = set[way - 1];
+    }
+    auto &entry = set[0];
+    entry.owner = this;
+    entry.trackersGeneration = trackersGeneration.load(std::memory_order_acquire);
+    entry.removals = removalsCount.load(std::memory_order_acquire);
+    entry.start = start;
+    entry.end = start + svmData->size;
+    entry.svmData = svmData;
 }
 
-void SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
+bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, const Device *device) {
     std::lock_guard<std::mutex> lock(this->mtx);
+    auto &cachedBytes = cachedBytesPerDevice[device];
+    if ((maxCachedBytesPerDevice != 0u) && (cachedBytes + size > maxCachedBytesPerDevice)) {
+        return false;
+    }
+    cachedBytes += size;
     allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    return true;
 }
 
 void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
@@ -36,19 +117,48 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
          allocationIter != allocations.end();
          ++allocationIter) {
+        if ((maxSizeRatio != 0u) && (allocationIter->allocationSize > size * maxSizeRatio)) {
+            break;
+        }
         void *allocationPtr = allocationIter->allocation;
         SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
         UNRECOVERABLE_IF(!svmAllocData);
         if (svmAllocData->device == unifiedMemoryProperties.device &&
             svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
+            isMatchingRootDeviceIndices(*svmAllocData, unifiedMemoryProperties)) {
+            cachedBytesPerDevice[svmAllocData->device] -= allocationIter->allocationSize;
             allocations.erase(allocationIter);
+            hitCount++;
             return allocationPtr;
         }
     }
+    missCount++;
     return nullptr;
 }
 
+bool SVMAllocsManager::SvmAllocationCache::isMatchingRootDeviceIndices(const SvmAllocationData &svmAllocData, const UnifiedMemoryProperties &unifiedMemoryProperties) {
+    if (unifiedMemoryProperties.device) {
+        return true;
+    }
+    size_t numAllocations = 0u;
+    for (auto allocation : svmAllocData.gpuAllocations.getGraphicsAllocations()) {
+        if (allocation) {
+            numAllocations++;
+        }
+    }
+    if (numAllocations != unifiedMemoryProperties.rootDeviceIndices.size()) {
+        return false;
+    }
+    for (auto rootDeviceIndex : unifiedMemoryProperties.rootDeviceIndices) {
+        if ((rootDeviceIndex > svmAllocData.gpuAllocations.getGraphicsAllocations().size() - 1) ||
+            (nullptr == svmAllocData.gpuAllocations.getGraphicsAllocation(rootDeviceIndex))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
     for (auto &cachedAllocationInfo : this->allocations) {
@@ -57,6 +167,7 @@ void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManag
         svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, false, svmData);
     }
     this->allocations.clear();
+    this->cachedBytesPerDevice.clear();
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -79,6 +190,7 @@ SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *
         svmAllocData = &iter->second;
         char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
         if (ptr < (charPtr + svmAllocData->size)) {
+            addToLookupCache(svmAllocData, reinterpret_cast<uintptr_t>(charPtr), ptr);
             return svmAllocData;
         }
     }
@@ -145,10 +257,23 @@ SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsCon
     if (this->usmDeviceAllocationsCacheEnabled) {
         this->initUsmDeviceAllocationsCache();
     }
+    this->usmHostAllocationsCacheEnabled = NEO::ApiSpecificConfig::isHostAllocationCacheEnabled();
+    if (DebugManager.flags.ExperimentalEnableHostAllocationCache.get() != -1) {
+        this->usmHostAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableHostAllocationCache.get();
+    }
+    if (this->usmHostAllocationsCacheEnabled) {
+        this->initUsmHostAllocationsCaches();
+    }
 }
 
 SVMAllocsManager::~SVMAllocsManager() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintUsmAllocationCacheStatistics.get(), stdout,
+                       "USM allocation cache hits/misses: device %llu/%llu, host %llu/%llu, shared %llu/%llu\n",
+                       static_cast<unsigned long long>(usmDeviceAllocationsCache.hitCount), static_cast<unsigned long long>(usmDeviceAllocationsCache.missCount),
+                       static_cast<unsigned long long>(usmHostAllocationsCache.hitCount), static_cast<unsigned long long>(usmHostAllocationsCache.missCount),
+                       static_cast<unsigned long long>(usmSharedAllocationsCache.hitCount), static_cast<unsigned long long>(usmSharedAllocationsCache.missCount));
     this->trimUSMDeviceAllocCache();
+    this->trimUSMHostAllocCaches();
 }
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
@@ -170,6 +295,15 @@ void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationPropertie
 
 void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
                                                           const UnifiedMemoryProperties &memoryProperties) {
+    if (this->usmHostAllocationsCacheEnabled &&
+        memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY &&
+        memoryProperties.allocationFlags.hostptr == 0u) {
+        void *allocationFromCache = this->usmHostAllocationsCache.get(size, memoryProperties, this);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     size_t pageSizeForAlignment = MemoryConstants::pageSize;
     size_t alignedSize = alignUp<size_t>(size, pageSizeForAlignment);
 
@@ -199,6 +333,9 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     void *externalHostPointer = reinterpret_cast<void *>(memoryProperties.allocationFlags.hostptr);
 
     void *usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    if (!usmPtr && this->trimUSMAllocCachesForRetry()) {
+        usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    }
     if (!usmPtr) {
         return nullptr;
     }
@@ -266,15 +403,11 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     }
 
     GraphicsAllocation *unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
+    if (!unifiedMemoryAllocation && this->trimUSMAllocCachesForRetry()) {
+        unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
+    }
     if (!unifiedMemoryAllocation) {
-        if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->trimUSMDeviceAllocCache();
-            unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
-        }
-        if (!unifiedMemoryAllocation) {
-            return nullptr;
-        }
+        return nullptr;
     }
     setUnifiedAllocationProperties(unifiedMemoryAllocation, {});
 
@@ -296,6 +429,13 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
 void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size,
                                                             const UnifiedMemoryProperties &memoryProperties,
                                                             void *cmdQ) {
+    if (this->usmHostAllocationsCacheEnabled) {
+        void *allocationFromCache = this->getSharedAllocationFromCache(size, memoryProperties, cmdQ);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     if (memoryProperties.rootDeviceIndices.size() > 1 && memoryProperties.device == nullptr) {
         return createHostUnifiedMemoryAllocation(size, memoryProperties);
     }
@@ -312,11 +452,17 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size,
 
         if (useKmdMigration) {
             unifiedMemoryPointer = createUnifiedKmdMigratedAllocation(size, {}, memoryProperties);
+            if (!unifiedMemoryPointer && this->trimUSMAllocCachesForRetry()) {
+                unifiedMemoryPointer = createUnifiedKmdMigratedAllocation(size, {}, memoryProperties);
+            }
             if (!unifiedMemoryPointer) {
                 return nullptr;
             }
         } else {
             unifiedMemoryPointer = createUnifiedAllocationWithDeviceStorage(size, {}, memoryProperties);
+            if (!unifiedMemoryPointer && this->trimUSMAllocCachesForRetry()) {
+                unifiedMemoryPointer = createUnifiedAllocationWithDeviceStorage(size, {}, memoryProperties);
+            }
             if (!unifiedMemoryPointer) {
                 return nullptr;
             }
@@ -381,6 +527,9 @@ void SVMAllocsManager::setUnifiedAllocationProperties(GraphicsAllocation *alloca
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
+    if (auto svmData = SVMAllocs.getFromLookupCache(ptr)) {
+        return svmData;
+    }
     std::shared_lock<std::shared_mutex> lock(mtx);
     return SVMAllocs.get(ptr);
 }
@@ -400,8 +549,27 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     if (svmData) {
         if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
             this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
-            return true;
+            if (this->usmDeviceAllocationsCache.insert(svmData->size, ptr, svmData->device)) {
+                return true;
+            }
+        }
+        if (InternalMemoryType::HOST_UNIFIED_MEMORY == svmData->memoryType &&
+            this->usmHostAllocationsCacheEnabled &&
+            isHostAllocationCacheable(*svmData)) {
+            if (this->usmHostAllocationsCache.insert(svmData->size, ptr, svmData->device)) {
+                return true;
+            }
+        }
+        if (InternalMemoryType::SHARED_UNIFIED_MEMORY == svmData->memoryType &&
+            this->usmHostAllocationsCacheEnabled &&
+            isHostAllocationCacheable(*svmData)) {
+            if (this->usmSharedAllocationsCache.insert(svmData->size, ptr, svmData->device)) {
+                auto pageFaultManager = this->memoryManager->getPageFaultManager();
+                if (pageFaultManager) {
+                    pageFaultManager->removeAllocation(ptr);
+                }
+                return true;
+            }
         }
         this->freeSVMAllocImpl(ptr, blocking, svmData);
         return true;
@@ -441,6 +609,41 @@ void SVMAllocsManager::trimUSMDeviceAllocCache() {
     this->usmDeviceAllocationsCache.trim(this);
 }
 
+void SVMAllocsManager::trimUSMHostAllocCaches() {
+    this->usmHostAllocationsCache.trim(this);
+    this->usmSharedAllocationsCache.trim(this);
+}
+
+bool SVMAllocsManager::trimUSMAllocCachesForRetry() {
+    // Memory kept in any of the caches may be what a failed allocation needs,
+    // returns whether the allocation is worth retrying
+    if (!this->usmDeviceAllocationsCacheEnabled && !this->usmHostAllocationsCacheEnabled) {
+        return false;
+    }
+    this->trimUSMDeviceAllocCache();
+    this->trimUSMHostAllocCaches();
+    return true;
+}
+
+bool SVMAllocsManager::isHostAllocationCacheable(const SvmAllocationData &svmData) const {
+    return !svmData.isImportedAllocation &&
+           svmData.allocationFlagsProperty.hostptr == 0u &&
+           !svmData.allocationFlagsProperty.flags.shareable;
+}
+
+void *SVMAllocsManager::getSharedAllocationFromCache(size_t size, const UnifiedMemoryProperties &memoryProperties, void *cmdQ) {
+    void *allocationFromCache = this->usmSharedAllocationsCache.get(size, memoryProperties, this);
+    if (allocationFromCache) {
+        auto svmData = this->getSVMAlloc(allocationFromCache);
+        if (svmData->cpuAllocation) {
+            UNRECOVERABLE_IF(cmdQ == nullptr);
+            auto pageFaultManager = this->memoryManager->getPageFaultManager();
+            pageFaultManager->insertAllocation(allocationFromCache, svmData->size, this, cmdQ, memoryProperties.allocationFlags);
+        }
+    }
+    return allocationFromCache;
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -552,6 +755,21 @@ void SVMAllocsManager::initUsmDeviceAllocationsCache() {
     this->usmDeviceAllocationsCache.allocations.reserve(128u);
 }
 
+void SVMAllocsManager::initUsmHostAllocationsCaches() {
+    this->usmHostAllocationsCache.maxCachedBytesPerDevice = SvmAllocationCache::defaultMaxCachedHostBytes;
+    if (DebugManager.flags.ExperimentalHostAllocationCacheMaxSize.get() != -1) {
+        this->usmHostAllocationsCache.maxCachedBytesPerDevice = static_cast<size_t>(DebugManager.flags.ExperimentalHostAllocationCacheMaxSize.get());
+    }
+    this->usmSharedAllocationsCache.maxCachedBytesPerDevice = SvmAllocationCache::defaultMaxCachedBytesPerDevice;
+    if (DebugManager.flags.ExperimentalSharedAllocationCacheMaxSize.get() != -1) {
+        this->usmSharedAllocationsCache.maxCachedBytesPerDevice = static_cast<size_t>(DebugManager.flags.ExperimentalSharedAllocationCacheMaxSize.get());
+    }
+    for (auto cache : {&this->usmHostAllocationsCache, &this->usmSharedAllocationsCache}) {
+        cache->allocations.reserve(128u);
+        cache->maxSizeRatio = 2u;
+    }
+}
+
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
     auto graphicsAllocations = svmData->gpuAllocations.getGraphicsAllocations();
     GraphicsAllocation *cpuAllocation = svmData->cpuAllocation;
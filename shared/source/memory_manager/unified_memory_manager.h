@@ -7,12 +7,14 @@
 
 #pragma once
 #include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -80,12 +82,50 @@ class SVMAllocsManager {
 
       public:
         using SvmAllocationContainer = std::map<const void *, SvmAllocationData>;
+        ~MapBasedAllocationTracker();
         void insert(SvmAllocationData);
         void remove(SvmAllocationData);
         SvmAllocationData *get(const void *);
+        // Lock-free lookup in per-thread cache of ranges resolved by get(), returns nullptr on miss
+        SvmAllocationData *getFromLookupCache(const void *ptr) const;
         size_t getNumAllocs() const { return allocations.size(); };
 
         SvmAllocationContainer allocations;
+
+      protected:
+        struct LookupCacheEntry {
+            const MapBasedAllocationTracker *owner = nullptr;
+            uint64_t trackersGeneration = 0u;
+            uint64_t removals = 0u;
+            uintptr_t start = 0u;
+            uintptr_t end = 0u;
+            SvmAllocationData *svmData = nullptr;
+        };
+        struct LookupCache {
+            static constexpr uint32_t numSetsShift = 5u;
+            static constexpr size_t numSets = 1u << numSetsShift;
+            static constexpr size_t numWays = 2u;
+            using Set = std::array<LookupCacheEntry, numWays>;
+            std::array<Set, numSets> sets;
+        };
+        struct RemovedRange {
+            std::atomic<uintptr_t> start{0u};
+            std::atomic<uintptr_t> end{0u};
+        };
+        static constexpr uint64_t removedRangesLogSize = 32u;
+
+        static size_t getLookupCacheSetIndex(uintptr_t address);
+        bool isRangeRemovedSince(uint64_t removals, uint64_t currentRemovals, uintptr_t start, uintptr_t end) const;
+        void addToLookupCache(SvmAllocationData *svmData, uintptr_t start, const void *ptr);
+
+        // Ranges of most recent removals, cached entries stay valid across removals of ranges they don't overlap
+        std::array<RemovedRange, removedRangesLogSize> removedRanges;
+        std::atomic<uint64_t> removalsStarted{0u};
+        std::atomic<uint64_t> removalsCount{0u};
+
+        // Bumped whenever a tracker is destroyed, so cached entries are never matched to a new tracker at the same address
+        static std::atomic<uint64_t> trackersGeneration;
+        static thread_local LookupCache lookupCache;
     };
 
     struct MapOperationsTracker {
@@ -136,10 +176,20 @@ class SVMAllocsManager {
     };
 
     struct SvmAllocationCache {
-        void insert(size_t size, void *);
+        static constexpr size_t defaultMaxCachedBytesPerDevice = 256 * MemoryConstants::megaByte;
+        static constexpr size_t defaultMaxCachedHostBytes = 256 * MemoryConstants::megaByte;
+
+        bool insert(size_t size, void *, const Device *device);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
+        static bool isMatchingRootDeviceIndices(const SvmAllocationData &svmAllocData, const UnifiedMemoryProperties &unifiedMemoryProperties);
         std::vector<SvmCacheAllocationInfo> allocations;
+        // Host USM allocations have no device and are all accounted under nullptr, so in host cache the limit is process-wide
+        std::map<const Device *, size_t> cachedBytesPerDevice;
+        size_t maxCachedBytesPerDevice = 0u; // 0 - no limit
+        size_t maxSizeRatio = 0u;            // 0 - any cached allocation not smaller than requested size is reused
+        uint64_t hitCount = 0u;
+        uint64_t missCount = 0u;
         std::mutex mtx;
     };
 
@@ -165,6 +215,8 @@ class SVMAllocsManager {
     MOCKABLE_VIRTUAL void freeSVMAllocImpl(void *ptr, bool blocking, SvmAllocationData *svmData);
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
+    void trimUSMHostAllocCaches();
+    bool trimUSMAllocCachesForRetry();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
@@ -200,6 +252,9 @@ class SVMAllocsManager {
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
     void initUsmDeviceAllocationsCache();
+    void initUsmHostAllocationsCaches();
+    bool isHostAllocationCacheable(const SvmAllocationData &svmData) const;
+    void *getSharedAllocationFromCache(size_t size, const UnifiedMemoryProperties &memoryProperties, void *cmdQ);
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
@@ -208,6 +263,9 @@ class SVMAllocsManager {
     std::mutex mtxForIndirectAccess;
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
+    SvmAllocationCache usmHostAllocationsCache;
+    SvmAllocationCache usmSharedAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
+    bool usmHostAllocationsCacheEnabled = false;
 };
 } // namespace NEO
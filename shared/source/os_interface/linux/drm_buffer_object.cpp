@@ -32,6 +32,8 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> BufferObject::stateGeneration{0u};
+
 BufferObject::BufferObject(Drm *drm, uint64_t patIndex, int handle, size_t size, size_t maxOsContextCount) : drm(drm), refCount(1), handle(handle), size(size) {
     auto ioctlHelper = drm->getIoctlHelper();
     this->tilingMode = ioctlHelper->getDrmParamValue(DrmParam::TilingNone);
@@ -50,6 +52,7 @@ BufferObject::BufferObject(Drm *drm, uint64_t patIndex, int handle, size_t size,
         bindInfo.resize(1);
         bindInfo[0].fill(false);
     }
+    stateGeneration++;
 }
 
 uint32_t BufferObject::getRefCount() const {
@@ -60,6 +63,7 @@ void BufferObject::setAddress(uint64_t address) {
     auto gmmHelper = drm->getRootDeviceEnvironment().getGmmHelper();
 
     this->gpuAddress = gmmHelper->canonize(address);
+    stateGeneration++;
 }
 
 bool BufferObject::close() {
@@ -125,9 +129,11 @@ void BufferObject::fillExecObject(ExecObject &execObject, OsContext *osContext,
 }
 
 int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
-                       BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, uint32_t completionValue) {
-    for (size_t i = 0; i < residencyCount; i++) {
-        residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+                       BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, uint32_t completionValue, bool residencyExecObjectsPrepared) {
+    if (!residencyExecObjectsPrepared) {
+        for (size_t i = 0; i < residencyCount; i++) {
+            residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
+        }
     }
     this->fillExecObject(execObjectsStorage[residencyCount], osContext, vmHandleId, drmContextId);
     auto ioctlHelper = drm->getIoctlHelper();
@@ -211,6 +217,7 @@ int BufferObject::bind(OsContext *osContext, uint32_t vmHandleId) {
         }
         if (!retVal) {
             this->bindInfo[contextId][vmHandleId] = true;
+            stateGeneration++;
         }
     }
     return retVal;
@@ -226,6 +233,7 @@ int BufferObject::unbind(OsContext *osContext, uint32_t vmHandleId) {
         }
         if (!retVal) {
             this->bindInfo[contextId][vmHandleId] = false;
+            stateGeneration++;
         }
     }
     return retVal;
@@ -267,7 +275,7 @@ int BufferObject::pin(BufferObject *const boToPin[], size_t numberOfBos, OsConte
         retVal = bindBOsWithinContext(boToPin, numberOfBos, osContext, vmHandleId);
     } else {
         StackVec<ExecObject, maxFragmentsCount + 1> execObject(numberOfBos + 1);
-        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0);
+        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0, false);
     }
 
     return retVal;
@@ -285,7 +293,7 @@ int BufferObject::validateHostPtr(BufferObject *const boToPin[], size_t numberOf
         }
     } else {
         StackVec<ExecObject, maxFragmentsCount + 1> execObject(numberOfBos + 1);
-        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0);
+        retVal = this->exec(4u, 0u, 0u, false, osContext, vmHandleId, drmContextId, boToPin, numberOfBos, &execObject[0], 0, 0, false);
     }
 
     return retVal;
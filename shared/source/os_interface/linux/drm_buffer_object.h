@@ -47,7 +47,8 @@ class BufferObject {
     MOCKABLE_VIRTUAL int validateHostPtr(BufferObject *const boToPin[], size_t numberOfBos, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
 
     MOCKABLE_VIRTUAL int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
-                              BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, uint32_t completionValue);
+                              BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, uint32_t completionValue, bool residencyExecObjectsPrepared);
+    MOCKABLE_VIRTUAL void fillExecObject(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
 
     int bind(OsContext *osContext, uint32_t vmHandleId);
     int unbind(OsContext *osContext, uint32_t vmHandleId);
@@ -80,6 +81,7 @@ class BufferObject {
     const StackVec<uint32_t, 2> &getBindExtHandles() const { return bindExtHandles; }
     void markForCapture() {
         allowCapture = true;
+        stateGeneration++;
     }
     bool isMarkedForCapture() {
         return allowCapture;
@@ -144,7 +146,13 @@ class BufferObject {
     uint32_t getOsContextId(OsContext *osContext);
     std::vector<std::array<bool, EngineLimits::maxHandleCount>> bindInfo;
 
+    // Bumped whenever any buffer object is created or changes state that is encoded in its exec object,
+    // allows callers to keep previously filled exec objects while the generation stays the same.
+    static uint64_t getStateGeneration() { return stateGeneration.load(); }
+
   protected:
+    static std::atomic<uint64_t> stateGeneration;
+
     MOCKABLE_VIRTUAL MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded);
 
     Drm *drm = nullptr;
@@ -161,7 +169,6 @@ class BufferObject {
     bool requiresImmediateBinding = false;
     bool requiresExplicitResidency = false;
 
-    MOCKABLE_VIRTUAL void fillExecObject(ExecObject &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
     void printBOBindingResult(OsContext *osContext, uint32_t vmHandleId, bool bind, int retVal);
 
     void *lockedAddress; // CPU side virtual address
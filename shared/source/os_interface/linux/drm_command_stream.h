@@ -66,14 +66,26 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     using CommandStreamReceiver::pageTableManager;
 
   protected:
+    struct ExecObjectsCache {
+        std::vector<BufferObject *> residency;
+        std::vector<ExecObject> execObjects;
+        uint64_t boStateGeneration = 0u;
+        uint32_t vmHandleId = 0u;
+        uint32_t drmContextId = 0u;
+        bool valid = false;
+    };
+
     MOCKABLE_VIRTUAL SubmissionStatus flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     MOCKABLE_VIRTUAL int exec(const BatchBuffer &batchBuffer, uint32_t vmHandleId, uint32_t drmContextId, uint32_t index);
     MOCKABLE_VIRTUAL int waitUserFence(uint32_t waitValue);
     MOCKABLE_VIRTUAL void readBackAllocation(void *source);
     bool isUserFenceWaitActive();
+    void prepareExecObjects(ExecObjectsCache &execObjectsCache, uint32_t vmHandleId, uint32_t drmContextId);
 
     std::vector<BufferObject *> residency;
-    std::vector<ExecObject> execObjectsStorage;
+    // Exec objects of last submission per context index, entries are refilled only for buffer objects that changed
+    std::vector<ExecObjectsCache> execObjectsCaches;
+    size_t lastReusedExecObjectsCount = 0u;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
 
@@ -82,5 +94,6 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
 
     bool useUserFenceWait = true;
     bool useContextForUserFenceWait = false;
+    bool useExecObjectsCache = true;
 };
 } // namespace NEO
@@ -27,6 +27,7 @@
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -45,7 +46,9 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
 
     this->drm = rootDeviceEnvironment->osInterface->getDriverModel()->as<Drm>();
     residency.reserve(512);
-    execObjectsStorage.reserve(512);
+    execObjectsCaches.resize(1);
+    execObjectsCaches[0].residency.reserve(512);
+    execObjectsCaches[0].execObjects.reserve(512);
 
     if (this->drm->isVmBindAvailable()) {
         gemCloseWorkerOperationMode = gemCloseWorkerMode::gemCloseWorkerInactive;
@@ -67,6 +70,9 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = static_cast<DispatchMode>(DebugManager.flags.CsrDispatchMode.get());
     }
+    if (DebugManager.flags.EnableExecObjectsCache.get() != -1) {
+        useExecObjectsCache = !!DebugManager.flags.EnableExecObjectsCache.get();
+    }
     int overrideUserFenceForCompletionWait = DebugManager.flags.EnableUserFenceForCompletionWait.get();
     if (overrideUserFenceForCompletionWait != -1) {
         useUserFenceWait = !!(overrideUserFenceForCompletionWait);
@@ -211,11 +217,12 @@ int DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, ui
     auto osContextLinux = static_cast<OsContextLinux *>(this->osContext);
     auto execFlags = osContextLinux->getEngineFlag() | drm->getIoctlHelper()->getDrmParamValue(DrmParam::ExecNoReloc);
 
-    // Residency hold all allocation except command buffer, hence + 1
-    auto requiredSize = this->residency.size() + 1;
-    if (requiredSize > this->execObjectsStorage.size()) {
-        this->execObjectsStorage.resize(requiredSize);
+    if (index >= this->execObjectsCaches.size()) {
+        this->execObjectsCaches.resize(index + 1);
     }
+    auto &execObjectsCache = this->execObjectsCaches[index];
+
+    prepareExecObjects(execObjectsCache, vmHandleId, drmContextId);
 
     uint64_t completionGpuAddress = 0;
     uint32_t completionValue = 0;
@@ -232,15 +239,49 @@ int DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, ui
                        vmHandleId,
                        drmContextId,
                        this->residency.data(), this->residency.size(),
-                       this->execObjectsStorage.data(),
+                       execObjectsCache.execObjects.data(),
                        completionGpuAddress,
-                       completionValue);
+                       completionValue,
+                       true);
 
+    execObjectsCache.residency.swap(this->residency);
     this->residency.clear();
 
     return ret;
 }
 
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::prepareExecObjects(ExecObjectsCache &execObjectsCache, uint32_t vmHandleId, uint32_t drmContextId) {
+    const auto boStateGeneration = BufferObject::getStateGeneration();
+    const bool cacheValid = this->useExecObjectsCache &&
+                            execObjectsCache.valid &&
+                            execObjectsCache.boStateGeneration == boStateGeneration &&
+                            execObjectsCache.vmHandleId == vmHandleId &&
+                            execObjectsCache.drmContextId == drmContextId;
+    const auto storedExecObjectsCount = execObjectsCache.execObjects.size();
+    const auto cachedCount = cacheValid ? std::min(execObjectsCache.residency.size(), storedExecObjectsCount) : 0u;
+
+    // Residency hold all allocation except command buffer, hence + 1
+    auto requiredSize = this->residency.size() + 1;
+    if (requiredSize > storedExecObjectsCount) {
+        execObjectsCache.execObjects.resize(requiredSize);
+    }
+
+    lastReusedExecObjectsCount = 0u;
+    for (size_t i = 0; i < this->residency.size(); i++) {
+        if (i < cachedCount && execObjectsCache.residency[i] == this->residency[i]) {
+            lastReusedExecObjectsCount++;
+            continue;
+        }
+        this->residency[i]->fillExecObject(execObjectsCache.execObjects[i], this->osContext, vmHandleId, drmContextId);
+    }
+
+    execObjectsCache.boStateGeneration = boStateGeneration;
+    execObjectsCache.vmHandleId = vmHandleId;
+    execObjectsCache.drmContextId = drmContextId;
+    execObjectsCache.valid = this->useExecObjectsCache;
+}
+
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
     bool ret = 0;
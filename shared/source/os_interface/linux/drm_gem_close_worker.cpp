@@ -7,15 +7,17 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <iostream>
-#include <queue>
 
 namespace NEO {
 
@@ -37,14 +39,22 @@ void DrmGemCloseWorker::closeThread() {
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+    printBatchStatistics();
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    // Same buffer object may be queued several times, so it can't be a list node itself and every push allocates
+    // a small reference node, outside of any lock, unlike std::queue blocks allocated under closeWorkerMutex.
+    queue.pushRefFrontOne(*bo);
+
+    // Worker publishes that it is going to sleep before checking the queue again under the mutex,
+    // acquiring the mutex here guarantees the notification is not lost.
+    if (workerWaiting.load()) {
+        std::unique_lock<std::mutex> lock(closeWorkerMutex);
+        lock.unlock();
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -59,46 +69,100 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+DrmGemCloseWorker::BatchStatistics DrmGemCloseWorker::getBatchStatistics() {
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    return batchStatistics;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
     memoryManager.unreference(bo, false);
     workCount--;
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
-    while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
-        inputQueue.pop();
-        close(workItem);
+void DrmGemCloseWorker::processQueue() {
+    auto nodes = queue.detachNodes();
+    if (nodes == nullptr) {
+        return;
+    }
+
+    batch.clear();
+    for (auto node = nodes; node != nullptr; node = node->next) {
+        batch.push_back(node->ref);
+    }
+    nodes->deleteThisAndAllNext();
+
+    // Nodes are detached newest first, buffer objects are closed in the order they were pushed
+    std::reverse(batch.begin(), batch.end());
+    processBatch(batch);
+}
+
+void DrmGemCloseWorker::processBatch(const std::vector<BufferObject *> &inputBatch) {
+    auto start = std::chrono::steady_clock::now();
+
+    // Same buffer object may be pushed multiple times, completion of each one is waited for only once per batch
+    batchToWait.assign(inputBatch.begin(), inputBatch.end());
+    std::sort(batchToWait.begin(), batchToWait.end());
+    batchToWait.erase(std::unique(batchToWait.begin(), batchToWait.end()), batchToWait.end());
+    for (auto bo : batchToWait) {
+        bo->wait(-1);
+    }
+
+    for (auto bo : inputBatch) {
+        close(bo);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    batchStatistics.batchCount++;
+    batchStatistics.closedCount += inputBatch.size();
+    batchStatistics.maxBatchSize = std::max(batchStatistics.maxBatchSize, static_cast<uint64_t>(inputBatch.size()));
+    batchStatistics.totalTime += elapsedTime;
+    batchStatistics.minTime = std::min(batchStatistics.minTime, elapsedTime);
+    batchStatistics.maxTime = std::max(batchStatistics.maxTime, elapsedTime);
+}
+
+void DrmGemCloseWorker::printBatchStatistics() {
+    if (!DebugManager.flags.PrintGemCloseWorkerStatistics.get()) {
+        return;
+    }
+
+    auto statistics = getBatchStatistics();
+    printf("\n--- Gem close worker statistics ---\n");
+    printf("Batches: %llu, closed buffer objects: %llu, max batch size: %llu\n",
+           static_cast<unsigned long long>(statistics.batchCount),
+           static_cast<unsigned long long>(statistics.closedCount),
+           static_cast<unsigned long long>(statistics.maxBatchSize));
+    if (statistics.batchCount > 0) {
+        printf("Batch time(ns) total: %lld, avg: %f, min: %lld, max: %lld\n",
+               statistics.totalTime,
+               statistics.totalTime / static_cast<double>(statistics.batchCount),
+               statistics.minTime,
+               statistics.maxTime);
     }
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    std::queue<BufferObject *> localQueue;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
     while (self->active) {
         lock.lock();
 
-        while (self->queue.empty() && self->active) {
+        self->workerWaiting.store(true);
+        while (self->queue.peekIsEmpty() && self->active) {
             self->condition.wait(lock);
         }
-
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
+        self->workerWaiting.store(false);
 
         lock.unlock();
-        self->processQueue(localQueue);
+        self->processQueue();
     }
 
-    lock.lock();
-    self->processQueue(self->queue);
+    self->processQueue();
 
-    lock.unlock();
     self->workerDone.store(true);
     return nullptr;
 }
@@ -6,13 +6,16 @@
  */
 
 #pragma once
+#include "shared/source/utilities/iflist.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -26,6 +29,15 @@ enum class gemCloseWorkerMode {
 
 class DrmGemCloseWorker {
   public:
+    struct BatchStatistics {
+        uint64_t batchCount = 0;
+        uint64_t closedCount = 0;
+        uint64_t maxBatchSize = 0;
+        long long totalTime = 0;
+        long long minTime = std::numeric_limits<long long>::max();
+        long long maxTime = 0;
+    };
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
@@ -36,18 +48,28 @@ class DrmGemCloseWorker {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    BatchStatistics getBatchStatistics();
 
   protected:
     void close(BufferObject *workItem);
     void closeThread();
-    void processQueue(std::queue<BufferObject *> &inputQueue);
+    void processQueue();
+    void processBatch(const std::vector<BufferObject *> &inputBatch);
+    void printBatchStatistics();
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    // Producers push without taking closeWorkerMutex, worker detaches all pending buffer objects at once
+    IFRefList<BufferObject, true, true> queue;
+    std::vector<BufferObject *> batch;
+    std::vector<BufferObject *> batchToWait;
     std::atomic<uint32_t> workCount{0};
+    std::atomic<bool> workerWaiting{false};
+
+    std::mutex statisticsMutex;
+    BatchStatistics batchStatistics;
 
     DrmMemoryManager &memoryManager;
 
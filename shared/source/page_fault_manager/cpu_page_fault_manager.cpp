@@ -8,7 +8,10 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -19,8 +22,15 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    const auto chunkSize = getMigrationChunkSize();
+    if ((chunkSize != 0u) && (size > chunkSize)) {
+        pageFaultData.chunkSize = chunkSize;
+        pageFaultData.chunkDomains.assign(Math::divideAndRoundUp(size, chunkSize), domain);
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -35,6 +45,9 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::Gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (pageFaultData.chunkSize != 0u) {
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -70,12 +83,14 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 }
 
 inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
-    if (pageFaultData.domain == AllocationDomain::Cpu) {
+    if (pageFaultData.domain == AllocationDomain::Cpu && pageFaultData.chunkSize != 0u) {
+        this->migrateChunksToGpuDomain(ptr, pageFaultData);
+    } else if (pageFaultData.domain == AllocationDomain::Cpu) {
         std::chrono::steady_clock::time_point start;
         std::chrono::steady_clock::time_point end;
 
         start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
+        this->transferToGpu(ptr, pageFaultData.size, ptr, pageFaultData.cmdQ);
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
@@ -86,20 +101,96 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
         this->protectCPUMemoryAccess(ptr, pageFaultData.size);
     }
     pageFaultData.domain = AllocationDomain::Gpu;
+    std::fill(pageFaultData.chunkDomains.begin(), pageFaultData.chunkDomains.end(), AllocationDomain::Gpu);
+}
+
+void PageFaultManager::migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    auto &chunkDomains = pageFaultData.chunkDomains;
+    const auto numChunks = chunkDomains.size();
+    size_t chunk = 0u;
+    while (chunk < numChunks) {
+        if (chunkDomains[chunk] != AllocationDomain::Cpu) {
+            chunk++;
+            continue;
+        }
+        auto lastChunk = chunk;
+        while ((lastChunk + 1 < numChunks) && (chunkDomains[lastChunk + 1] == AllocationDomain::Cpu)) {
+            lastChunk++;
+        }
+        const auto rangeOffset = chunk * pageFaultData.chunkSize;
+        const auto rangeSize = std::min((lastChunk + 1) * pageFaultData.chunkSize, pageFaultData.size) - rangeOffset;
+        auto rangePtr = ptrOffset(ptr, rangeOffset);
+
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+
+        start = std::chrono::steady_clock::now();
+        this->transferToGpu(rangePtr, rangeSize, ptr, pageFaultData.cmdQ);
+        end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation range %llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(rangePtr), rangeSize, elapsedTime / 1e3);
+        }
+
+        this->protectCPUMemoryAccess(rangePtr, rangeSize);
+        chunk = lastChunk + 1;
+    }
+}
+
+void PageFaultManager::handleChunkPageFault(void *allocPtr, PageFaultData &pageFaultData, void *faultPtr) {
+    const auto chunk = ptrDiff(faultPtr, allocPtr) / pageFaultData.chunkSize;
+    const auto chunkOffset = chunk * pageFaultData.chunkSize;
+    PageFaultData chunkData{std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset),
+                            pageFaultData.unifiedMemoryManager,
+                            pageFaultData.cmdQ,
+                            pageFaultData.chunkDomains[chunk]};
+    chunkData.isChunk = true;
+
+    // Only the faulted chunk becomes host writable, so only its pages need to be dumped again
+    this->setAubWritableRange(allocPtr, chunkOffset, chunkData.size, pageFaultData.unifiedMemoryManager);
+    gpuDomainHandler(this, ptrOffset(allocPtr, chunkOffset), chunkData);
+
+    pageFaultData.chunkDomains[chunk] = chunkData.domain;
+    if (chunkData.domain == AllocationDomain::Cpu) {
+        if (pageFaultData.domain == AllocationDomain::Gpu) {
+            pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+        }
+        pageFaultData.domain = AllocationDomain::Cpu;
+    }
+}
+
+std::unordered_map<void *, PageFaultManager::PageFaultData>::iterator PageFaultManager::findAllocation(void *ptr) {
+    for (auto alloc = this->memoryData.begin(); alloc != this->memoryData.end(); ++alloc) {
+        if (ptr >= alloc->first && ptr < ptrOffset(alloc->first, alloc->second.size)) {
+            return alloc;
+        }
+    }
+    return this->memoryData.end();
+}
+
+size_t PageFaultManager::getMigrationChunkSize() const {
+    if (DebugManager.flags.SharedAllocationMigrationChunkSize.get() != -1) {
+        return alignUp(static_cast<size_t>(DebugManager.flags.SharedAllocationMigrationChunkSize.get()), MemoryConstants::pageSize);
+    }
+    return defaultMigrationChunkSize;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+    auto alloc = findAllocation(ptr);
+    if (alloc == this->memoryData.end()) {
+        return false;
     }
-    return false;
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (pageFaultData.chunkSize != 0u) {
+        handleChunkPageFault(allocPtr, pageFaultData, ptr);
+    } else {
+        this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+        gpuDomainHandler(this, allocPtr, pageFaultData);
+    }
+    return true;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -129,7 +220,9 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
         if (DebugManager.flags.PrintUmdSharedMigration.get()) {
             printf("UMD transferred shared allocation %llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
         }
-        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+        if (!pageFaultData.isChunk) {
+            pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+        }
     }
     pageFaultData.domain = AllocationDomain::Cpu;
 }
@@ -146,4 +239,10 @@ void PageFaultManager::setAubWritable(bool writable, void *ptr, SVMAllocsManager
     gpuAlloc->setAubWritable(writable, GraphicsAllocation::allBanks);
 }
 
+void PageFaultManager::setAubWritableRange(void *ptr, size_t offset, size_t size, SVMAllocsManager *unifiedMemoryManager) {
+    UNRECOVERABLE_IF(ptr == nullptr);
+    auto gpuAlloc = unifiedMemoryManager->getSVMAlloc(ptr)->gpuAllocations.getDefaultGraphicsAllocation();
+    gpuAlloc->setAubWritableRange(offset, size, GraphicsAllocation::allBanks);
+}
+
 } // namespace NEO
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -14,6 +15,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -24,6 +26,8 @@ class PageFaultManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PageFaultManager> create();
 
+    static constexpr size_t defaultMigrationChunkSize = 2 * MemoryConstants::megaByte;
+
     virtual ~PageFaultManager() = default;
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
@@ -42,6 +46,11 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        // Allocations larger than chunkSize are protected and migrated per chunk,
+        // chunkDomains holds current domain of each chunk
+        size_t chunkSize = 0u;
+        std::vector<AllocationDomain> chunkDomains;
+        bool isChunk = false;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -56,14 +65,19 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
-    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, size_t size, void *allocPtr, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
+    MOCKABLE_VIRTUAL void setAubWritableRange(void *ptr, size_t offset, size_t size, SVMAllocsManager *unifiedMemoryManager);
 
     static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void handleGpuDomainTransferForAubAndTbx(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void handleChunkPageFault(void *allocPtr, PageFaultData &pageFaultData, void *faultPtr);
+    std::unordered_map<void *, PageFaultData>::iterator findAllocation(void *ptr);
+    size_t getMigrationChunkSize() const;
 
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
 
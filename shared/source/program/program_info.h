@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/external_functions.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/utilities/arrayref.h"
 
 #include <cstddef>
 #include <memory>
@@ -47,6 +48,7 @@ struct ProgramInfo {
     std::vector<KernelInfo *> kernelInfos;
     uint32_t grfSize = 32U;
     uint32_t minScratchSpaceSize = 0U;
+    ArrayRef<const uint8_t> zeInfoBlob;
 };
 
 size_t getMaxInlineSlmNeeded(const ProgramInfo &programInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,103 @@
 
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace NEO {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
     return hc1.ptr < hc2.ptr;
 }
+
+void FreedChunks::store(uint64_t ptr, size_t size) {
+    uint64_t chunkStart = ptr;
+    uint64_t chunkEnd = ptr + size;
+
+    auto it = chunksByAddress.upper_bound(chunkStart);
+    if (it != chunksByAddress.begin()) {
+        auto previous = std::prev(it);
+        const uint64_t previousEnd = previous->first + previous->second;
+        if (previousEnd >= chunkStart) {
+            chunkStart = previous->first;
+            chunkEnd = std::max(chunkEnd, previousEnd);
+            it = erase(previous);
+        }
+    }
+
+    while (it != chunksByAddress.end() && it->first <= chunkEnd) {
+        chunkEnd = std::max(chunkEnd, it->first + it->second);
+        it = erase(it);
+    }
+
+    insert(chunkStart, static_cast<size_t>(chunkEnd - chunkStart));
+}
+
+bool FreedChunks::findBestFit(size_t size, size_t requiredAlignment, uint64_t &ptr, size_t &chunkSize) const {
+    for (auto it = chunksBySize.lower_bound({size, 0llu}); it != chunksBySize.end(); ++it) {
+        if (isAligned(it->second, requiredAlignment)) {
+            ptr = it->second;
+            chunkSize = it->first;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FreedChunks::remove(uint64_t ptr) {
+    auto it = chunksByAddress.find(ptr);
+    DEBUG_BREAK_IF(it == chunksByAddress.end());
+    erase(it);
+}
+
+void FreedChunks::shrink(uint64_t ptr, size_t newSize) {
+    auto it = chunksByAddress.find(ptr);
+    DEBUG_BREAK_IF(it == chunksByAddress.end());
+    chunksBySize.erase({it->second, ptr});
+    it->second = newSize;
+    chunksBySize.emplace(newSize, ptr);
+}
+
+bool FreedChunks::takeChunkStartingAt(uint64_t ptr, size_t &chunkSize) {
+    auto it = chunksByAddress.find(ptr);
+    if (it == chunksByAddress.end()) {
+        return false;
+    }
+    chunkSize = it->second;
+    erase(it);
+    return true;
+}
+
+bool FreedChunks::takeChunkEndingAt(uint64_t endPtr, uint64_t &ptr) {
+    auto it = chunksByAddress.lower_bound(endPtr);
+    if (it == chunksByAddress.begin()) {
+        return false;
+    }
+    auto previous = std::prev(it);
+    if (previous->first + previous->second != endPtr) {
+        return false;
+    }
+    ptr = previous->first;
+    erase(previous);
+    return true;
+}
+
+std::vector<HeapChunk> FreedChunks::getChunks() const {
+    std::vector<HeapChunk> chunks;
+    chunks.reserve(chunksByAddress.size());
+    for (const auto &chunk : chunksByAddress) {
+        chunks.emplace_back(chunk.first, chunk.second);
+    }
+    return chunks;
+}
+
+void FreedChunks::insert(uint64_t ptr, size_t size) {
+    chunksByAddress.emplace(ptr, size);
+    chunksBySize.emplace(size, ptr);
+}
+
+FreedChunks::ChunksByAddressT::iterator FreedChunks::erase(ChunksByAddressT::iterator it) {
+    chunksBySize.erase({it->second, it->first});
+    return chunksByAddress.erase(it);
+}
 } // namespace NEO
@@ -9,8 +9,10 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 
-#include <algorithm>
 #include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
 #include <vector>
 
 namespace NEO {
@@ -23,6 +25,36 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+// Free ranges indexed both by address (for coalescing neighbours on store)
+// and by size (for best-fit lookup), so that both operations are logarithmic.
+class FreedChunks {
+  public:
+    void store(uint64_t ptr, size_t size);
+    bool findBestFit(size_t size, size_t requiredAlignment, uint64_t &ptr, size_t &chunkSize) const;
+    void remove(uint64_t ptr);
+    void shrink(uint64_t ptr, size_t newSize);
+    bool takeChunkStartingAt(uint64_t ptr, size_t &chunkSize);
+    bool takeChunkEndingAt(uint64_t endPtr, uint64_t &ptr);
+    std::vector<HeapChunk> getChunks() const;
+
+    size_t size() const {
+        return chunksByAddress.size();
+    }
+
+    bool empty() const {
+        return chunksByAddress.empty();
+    }
+
+  protected:
+    using ChunksByAddressT = std::map<uint64_t, size_t>;
+
+    void insert(uint64_t ptr, size_t size);
+    ChunksByAddressT::iterator erase(ChunksByAddressT::iterator it);
+
+    ChunksByAddressT chunksByAddress;
+    std::set<std::pair<size_t, uint64_t>> chunksBySize;
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, MemoryConstants::pageSize) {
@@ -34,8 +66,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -56,54 +86,45 @@ class HeapAllocator {
             return 0llu;
         }
 
-        std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
-        uint32_t defragmentCount = 0;
-
-        for (;;) {
-            size_t sizeOfFreedChunk = 0;
-            uint64_t ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk, alignment);
-
-            if (ptrReturn == 0llu) {
-                if (sizeToAllocate > sizeThreshold) {
-                    const uint64_t misalignment = alignUp(pLeftBound, alignment) - pLeftBound;
-                    if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
-                        if (misalignment) {
-                            storeInFreedChunks(pLeftBound, static_cast<size_t>(misalignment), freedChunks);
-                            pLeftBound += misalignment;
-                        }
-                        ptrReturn = pLeftBound;
-                        pLeftBound += sizeToAllocate;
+        FreedChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+        size_t sizeOfFreedChunk = 0;
+        uint64_t ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk, alignment);
+
+        if (ptrReturn == 0llu) {
+            if (sizeToAllocate > sizeThreshold) {
+                const uint64_t misalignment = alignUp(pLeftBound, alignment) - pLeftBound;
+                if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
+                    if (misalignment) {
+                        storeInFreedChunks(pLeftBound, static_cast<size_t>(misalignment), freedChunks);
+                        pLeftBound += misalignment;
                     }
-                } else {
-                    const uint64_t pStart = pRightBound - sizeToAllocate;
-                    const uint64_t misalignment = pStart - alignDown(pStart, alignment);
-                    if (pLeftBound + sizeToAllocate + misalignment <= pRightBound) {
-                        if (misalignment) {
-                            pRightBound -= misalignment;
-                            storeInFreedChunks(pRightBound, static_cast<size_t>(misalignment), freedChunks);
-                        }
-                        pRightBound -= sizeToAllocate;
-                        ptrReturn = pRightBound;
+                    ptrReturn = pLeftBound;
+                    pLeftBound += sizeToAllocate;
+                }
+            } else {
+                const uint64_t pStart = pRightBound - sizeToAllocate;
+                const uint64_t misalignment = pStart - alignDown(pStart, alignment);
+                if (pLeftBound + sizeToAllocate + misalignment <= pRightBound) {
+                    if (misalignment) {
+                        pRightBound -= misalignment;
+                        storeInFreedChunks(pRightBound, static_cast<size_t>(misalignment), freedChunks);
                     }
+                    pRightBound -= sizeToAllocate;
+                    ptrReturn = pRightBound;
                 }
             }
+        }
 
-            if (ptrReturn != 0llu) {
-                if (sizeOfFreedChunk > 0) {
-                    availableSize -= sizeOfFreedChunk;
-                    sizeToAllocate = sizeOfFreedChunk;
-                } else {
-                    availableSize -= sizeToAllocate;
-                }
-                DEBUG_BREAK_IF(!isAligned(ptrReturn, alignment));
-                return ptrReturn;
+        if (ptrReturn != 0llu) {
+            if (sizeOfFreedChunk > 0) {
+                availableSize -= sizeOfFreedChunk;
+                sizeToAllocate = sizeOfFreedChunk;
+            } else {
+                availableSize -= sizeToAllocate;
             }
-
-            if (defragmentCount == 1)
-                return 0llu;
-            defragment();
-            defragmentCount++;
+            DEBUG_BREAK_IF(!isAligned(ptrReturn, alignment));
         }
+        return ptrReturn;
     }
 
     void free(uint64_t ptr, size_t size) {
@@ -149,136 +170,54 @@ class HeapAllocator {
     size_t allocationAlignment;
     const size_t sizeThreshold;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    FreedChunks freedChunksSmall;
+    FreedChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
-        size_t elements = freedChunks.size();
-        size_t bestFitIndex = -1;
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
+        uint64_t bestFitPtr = 0llu;
         size_t bestFitSize = 0;
         sizeOfFreedChunk = 0;
 
-        for (size_t i = 0; i < elements; i++) {
-            const bool chunkAligned = isAligned(freedChunks[i].ptr, requiredAlignment);
-            if (!chunkAligned) {
-                continue;
-            }
+        if (false == freedChunks.findBestFit(size, requiredAlignment, bestFitPtr, bestFitSize)) {
+            return 0llu;
+        }
 
-            if (freedChunks[i].size == size) {
-                auto ptr = freedChunks[i].ptr;
-                freedChunks.erase(freedChunks.begin() + i);
-                return ptr;
-            }
+        if (bestFitSize == size) {
+            freedChunks.remove(bestFitPtr);
+            return bestFitPtr;
+        }
 
-            if (freedChunks[i].size > size) {
-                if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                    bestFitIndex = i;
-                    bestFitSize = freedChunks[i].size;
-                }
-            }
+        if (bestFitSize < (size << 1)) {
+            sizeOfFreedChunk = bestFitSize;
+            freedChunks.remove(bestFitPtr);
+            return bestFitPtr;
         }
 
-        if (bestFitSize != 0) {
-            if (bestFitSize < (size << 1)) {
-                auto ptr = freedChunks[bestFitIndex].ptr;
-                sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-                freedChunks.erase(freedChunks.begin() + bestFitIndex);
-                return ptr;
-            } else {
-                size_t sizeDelta = freedChunks[bestFitIndex].size - size;
+        size_t sizeDelta = bestFitSize - size;
 
-                DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
+        DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
 
-                auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-                freedChunks[bestFitIndex].size = sizeDelta;
-                return ptr;
-            }
-        }
-        return 0llu;
+        freedChunks.shrink(bestFitPtr, sizeDelta);
+        return bestFitPtr + sizeDelta;
     }
 
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
-            }
-            if ((freedChunk.ptr + freedChunk.size) == (ptr + size)) {
-                if (ptr < freedChunk.ptr) {
-                    freedChunk.ptr = ptr;
-                    freedChunk.size = size;
-                    return;
-                }
-            }
-        }
-
-        freedChunks.emplace_back(ptr, size);
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &freedChunks) {
+        freedChunks.store(ptr, size);
     }
 
     void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
-            }
+        size_t chunkSize = 0;
+        if (freedChunksSmall.takeChunkStartingAt(pRightBound, chunkSize)) {
+            pRightBound += chunkSize;
         }
     }
 
     void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
-            }
-        }
-    }
-
-    void defragment() {
-
-        if (freedChunksSmall.size() > 1) {
-            std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-            size_t maxSize = freedChunksSmall.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksSmall[i].ptr;
-                size_t chunkSize = freedChunksSmall[i].size;
-
-                if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                    freedChunksSmall[i - 1].ptr = ptr;
-                    freedChunksSmall[i - 1].size += chunkSize;
-                    freedChunksSmall.erase(freedChunksSmall.begin() + i);
-                }
-            }
-        }
-        mergeLastFreedSmall();
-        if (freedChunksBig.size() > 1) {
-            std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-            size_t maxSize = freedChunksBig.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksBig[i].ptr;
-                size_t chunkSize = freedChunksBig[i].size;
-                if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                    freedChunksBig[i - 1].size += chunkSize;
-                    freedChunksBig.erase(freedChunksBig.begin() + i);
-                }
-            }
+        uint64_t ptr = 0llu;
+        if (freedChunksBig.takeChunkEndingAt(pLeftBound, ptr)) {
+            pLeftBound = ptr;
         }
-        mergeLastFreedBig();
-        DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
     }
 };
 } // namespace NEO
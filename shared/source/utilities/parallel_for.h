@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Calls func(index) for every index in [0, count) using up to workersCount threads, calling thread included.
+// Indices are handed out dynamically, so func must not depend on the order in which they are processed.
+template <typename FuncT>
+void parallelFor(size_t count, uint32_t workersCount, FuncT &&func) {
+    const auto threadsCount = std::min(static_cast<size_t>(workersCount), count);
+    if (threadsCount <= 1) {
+        for (size_t index = 0; index < count; index++) {
+            func(index);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextIndex{0u};
+    auto worker = [&]() {
+        for (auto index = nextIndex++; index < count; index = nextIndex++) {
+            func(index);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount - 1);
+    for (size_t i = 1; i < threadsCount; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/fixtures/memory_allocator_fixture.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <array>
+#include <string>
+
+using namespace NEO;
+
+using AllocationsListBenchmark = Test<MemoryAllocatorFixture>;
+
+// Replays flushTask-style churn: every task obtains a command buffer, heap or staging buffer from
+// the CSR reusable list and stores it back with its task count, while GPU completion lags behind.
+// Larger lag means more in-flight allocations in the reusable list that lookups have to skip.
+TEST_F(AllocationsListBenchmark, ObtainAndStoreReusableAllocationsWithLaggingGpu) {
+    const std::array<AllocationType, 3> allocationTypes = {AllocationType::COMMAND_BUFFER, AllocationType::LINEAR_STREAM, AllocationType::BUFFER};
+    const std::array<size_t, 3> allocationSizes = {MemoryConstants::pageSize, 4 * MemoryConstants::pageSize, 16 * MemoryConstants::pageSize};
+    constexpr uint32_t iterations = 20000u;
+
+    auto storage = csr->getInternalAllocationStorage();
+    auto contextId = csr->getOsContext().getContextId();
+
+    for (uint32_t gpuLag : {8u, 128u, 1024u}) {
+        uint32_t allocationsCreated = 0u;
+        uint32_t wrongAllocationsReused = 0u;
+        *csr->getTagAddress() = 0u;
+
+        auto seconds = Benchmark::measure(1u, [&]() {
+            for (uint32_t taskCount = 1u; taskCount <= iterations; taskCount++) {
+                const auto allocationType = allocationTypes[taskCount % allocationTypes.size()];
+                const auto allocationSize = allocationSizes[(taskCount / allocationTypes.size()) % allocationSizes.size()];
+
+                auto allocation = storage->obtainReusableAllocation(allocationSize, allocationType);
+                if (allocation) {
+                    if (allocation->getTaskCount(contextId) > *csr->getTagAddress()) {
+                        wrongAllocationsReused++;
+                    }
+                } else {
+                    allocation.reset(memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, allocationSize, allocationType, mockDeviceBitfield}));
+                    allocationsCreated++;
+                }
+
+                storage->storeAllocationWithTaskCount(std::move(allocation), REUSABLE_ALLOCATION, taskCount);
+                if (taskCount > gpuLag) {
+                    *csr->getTagAddress() = taskCount - gpuLag;
+                }
+            }
+        });
+
+        EXPECT_EQ(0u, wrongAllocationsReused);
+        EXPECT_LE(allocationsCreated, allocationTypes.size() * allocationSizes.size() * (gpuLag + 1));
+
+        auto variant = "GPU lag " + std::to_string(gpuLag) + ", " + std::to_string(allocationsCreated) + " allocations";
+        Benchmark::reportOperations("reusable allocation churn", variant.c_str(), seconds, iterations);
+
+        *csr->getTagAddress() = iterations;
+        storage->cleanAllocationList(iterations, REUSABLE_ALLOCATION);
+    }
+}
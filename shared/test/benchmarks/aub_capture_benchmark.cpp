@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/aub_mem_dump/page_table_entry_bits.h"
+#include "shared/source/command_stream/aub_command_stream_receiver_hw.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_aub_csr.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+struct AubCaptureBenchmarkFixture {
+    void setUp() {}
+    void tearDown() {}
+};
+
+using AubCaptureBenchmark = Test<AubCaptureBenchmarkFixture>;
+
+// Captures memory of allocations with AUB CSR writing to a file, with no device behind it.
+// Synchronous std::ofstream writes (buffer size 0) are compared against the background writer.
+HWTEST_F(AubCaptureBenchmark, WriteAllocationsWithAubCsr) {
+    constexpr size_t allocationCount = 32u;
+    constexpr size_t allocationSize = MemoryConstants::megaByte;
+    constexpr size_t iterations = 4u;
+    constexpr uint64_t gpuAddressBase = 0x40000000;
+    std::vector<uint8_t> memory(allocationSize, 0xab);
+
+    for (int32_t writerBufferSize : {0, -1}) {
+        DebugManagerStateRestore restorer;
+        DebugManager.flags.AUBDumpFileWriterBufferSize.set(writerBufferSize);
+        std::string fileName = "aub_capture_benchmark.aub";
+
+        auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+        auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+
+        auto seconds = Benchmark::measure(1u, [&]() {
+            aubCsr->initFile(fileName);
+            aubCsr->initializeEngine();
+            for (size_t iteration = 0; iteration < iterations; iteration++) {
+                for (size_t allocationId = 0; allocationId < allocationCount; allocationId++) {
+                    aubCsr->writeMemory(gpuAddressBase + allocationId * allocationSize, memory.data(), allocationSize, MemoryBanks::MainBank, PageTableEntry::presentBit);
+                }
+                aubCsr->getAubStream()->flush();
+            }
+            aubCsr->closeFile();
+        });
+
+        std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+        auto fileSize = static_cast<size_t>(file.tellg());
+        file.close();
+        std::remove(fileName.c_str());
+        EXPECT_LT(iterations * allocationCount * allocationSize, fileSize);
+
+        Benchmark::report("aub capture", writerBufferSize == 0 ? "synchronous writes" : "background writer", seconds, fileSize);
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace NEO {
+namespace Benchmark {
+
+// Runs func given number of times and returns average duration of single run in seconds
+template <typename FuncT>
+double measure(size_t iterations, FuncT &&func) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        func();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(iterations);
+}
+
+inline void report(const char *name, const char *variant, double seconds, size_t bytesProcessed) {
+    auto megabytesPerSecond = static_cast<double>(bytesProcessed) / (1024.0 * 1024.0) / seconds;
+    printf("[ BENCHMARK ] %s (%s): %.3f ms, %.1f MB/s\n", name, variant, seconds * 1000.0, megabytesPerSecond);
+}
+
+inline void reportOperations(const char *name, const char *variant, double seconds, size_t operations) {
+    auto nanosecondsPerOperation = seconds * 1e9 / static_cast<double>(operations);
+    printf("[ BENCHMARK ] %s (%s): %.3f ms, %.1f ns/op\n", name, variant, seconds * 1000.0, nanosecondsPerOperation);
+}
+
+} // namespace Benchmark
+} // namespace NEO
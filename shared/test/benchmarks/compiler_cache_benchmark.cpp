@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+// Models module builds at service start-up - every thread loads all cached entries from disk.
+// Loads take no lock, so total throughput is expected to scale with the number of threads.
+TEST(CompilerCacheBenchmark, LoadCachedBinariesFromMultipleThreads) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_benchmark_cache";
+    CompilerCache cache(config);
+
+    constexpr uint32_t entryCount = 32u;
+    constexpr uint32_t binarySize = 1024u * 1024u;
+    std::vector<char> binary(binarySize);
+    for (uint32_t entryId = 0; entryId < entryCount; entryId++) {
+        std::fill(binary.begin(), binary.end(), static_cast<char>(entryId));
+        ASSERT_TRUE(cache.cacheBinary("cache_benchmark_" + std::to_string(entryId), binary.data(), binarySize));
+    }
+
+    for (uint32_t threadCount : {1u, 2u, 4u, 8u, 16u}) {
+        std::atomic<uint32_t> failures{0u};
+        auto worker = [&](uint32_t threadId) {
+            for (uint32_t i = 0; i < entryCount; i++) {
+                // threads start at different entries, so that loads of the same entry overlap only partially
+                auto entryId = (threadId + i) % entryCount;
+                size_t size = 0u;
+                auto loaded = cache.loadCachedBinary("cache_benchmark_" + std::to_string(entryId), size);
+                if (loaded == nullptr || size != binarySize) {
+                    failures++;
+                }
+            }
+        };
+
+        auto seconds = Benchmark::measure(4u, [&]() {
+            std::vector<std::thread> threads;
+            for (uint32_t threadId = 0; threadId < threadCount; threadId++) {
+                threads.emplace_back(worker, threadId);
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        });
+        EXPECT_EQ(0u, failures.load());
+
+        auto variant = std::to_string(threadCount) + " threads";
+        Benchmark::report("compiler cache load", variant.c_str(), seconds, size_t{threadCount} * entryCount * binarySize);
+    }
+
+    for (uint32_t entryId = 0; entryId < entryCount; entryId++) {
+        std::remove(("./cache_benchmark_" + std::to_string(entryId) + ".neo_benchmark_cache").c_str());
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Sizes cover small OpenCL C sources up to multi-megabyte SPIR-V, which are hashed into compiler cache keys
+TEST(HashBenchmark, HashCompilerCacheKeyInputs) {
+    for (size_t inputSize : {size_t{4 * MemoryConstants::kiloByte}, size_t{64 * MemoryConstants::kiloByte}, size_t{4 * MemoryConstants::megaByte}}) {
+        std::vector<char> input(inputSize);
+        for (size_t i = 0; i < input.size(); i++) {
+            input[i] = static_cast<char>(i * 31 + (i >> 8));
+        }
+        auto iterations = 64 * MemoryConstants::megaByte / inputSize;
+        auto variant = std::to_string(inputSize / MemoryConstants::kiloByte) + " KB";
+
+        uint64_t hash = 0u;
+        auto seconds = Benchmark::measure(iterations, [&]() { hash = Hash::hash(input.data(), input.size()); });
+        Benchmark::report("Hash", variant.c_str(), seconds, inputSize);
+
+        Hash128Value hash128;
+        seconds = Benchmark::measure(iterations, [&]() { hash128 = Hash128::hash(input.data(), input.size()); });
+        Benchmark::report("Hash128", variant.c_str(), seconds, inputSize);
+
+        EXPECT_EQ(Hash::hash(input.data(), input.size()), hash);
+        EXPECT_EQ(Hash128::hash(input.data(), input.size()), hash128);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/mocks/mock_gfx_partition.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+
+struct TraceOperation {
+    bool allocate;
+    size_t size;
+    uint32_t victim;
+};
+
+// Grows to liveAllocationsTarget live allocations, then interleaves allocations and frees of random victims
+std::vector<TraceOperation> generateAllocationTrace(size_t liveAllocationsTarget, size_t steadyStateOperations) {
+    const size_t allocationSizes[] = {MemoryConstants::pageSize, 2 * MemoryConstants::pageSize, MemoryConstants::pageSize64k,
+                                      MemoryConstants::megaByte, 2 * MemoryConstants::megaByte, 6 * MemoryConstants::megaByte,
+                                      16 * MemoryConstants::megaByte};
+    std::mt19937 generator(7);
+    std::vector<TraceOperation> trace;
+    trace.reserve(liveAllocationsTarget + steadyStateOperations);
+    for (size_t i = 0; i < liveAllocationsTarget + steadyStateOperations; i++) {
+        bool allocate = (i < liveAllocationsTarget) || (generator() % 2 == 0);
+        trace.push_back({allocate, allocationSizes[generator() % (sizeof(allocationSizes) / sizeof(allocationSizes[0]))], static_cast<uint32_t>(generator())});
+    }
+    return trace;
+}
+
+} // namespace
+
+TEST(HeapAllocatorBenchmark, ReplayAllocationTraceAgainstGfxPartitionHeaps) {
+    MockGfxPartition gfxPartition;
+    ASSERT_TRUE(gfxPartition.init(maxNBitValue(48), 0, 0, 1));
+
+    auto trace = generateAllocationTrace(30000, 200000);
+    for (auto heap : {HeapIndex::HEAP_STANDARD, HeapIndex::HEAP_STANDARD64KB}) {
+        std::vector<std::pair<uint64_t, size_t>> liveAllocations;
+        liveAllocations.reserve(trace.size());
+        size_t failedAllocations = 0u;
+
+        auto seconds = Benchmark::measure(1u, [&]() {
+            for (auto &operation : trace) {
+                if (operation.allocate || liveAllocations.empty()) {
+                    size_t size = operation.size;
+                    auto ptr = gfxPartition.heapAllocate(heap, size);
+                    if (ptr == 0u) {
+                        failedAllocations++;
+                        continue;
+                    }
+                    liveAllocations.push_back({ptr, size});
+                } else {
+                    auto victim = operation.victim % liveAllocations.size();
+                    gfxPartition.heapFree(heap, liveAllocations[victim].first, liveAllocations[victim].second);
+                    liveAllocations[victim] = liveAllocations.back();
+                    liveAllocations.pop_back();
+                }
+            }
+            for (auto &allocation : liveAllocations) {
+                gfxPartition.heapFree(heap, allocation.first, allocation.second);
+            }
+        });
+
+        EXPECT_EQ(0u, failedAllocations);
+
+        auto variant = (heap == HeapIndex::HEAP_STANDARD) ? "standard heap" : "standard 64KB heap";
+        Benchmark::reportOperations("heap allocator trace replay", variant, seconds, trace.size() + liveAllocations.size());
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/compiler_interface/linker_mock.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Patches ISA of a synthetic module the way module load does, every kernel referencing global
+// symbols from its own instruction segment. Serial patching is compared against worker counts
+// used by ModuleLoadWorkersCount.
+TEST(LinkerBenchmark, PatchInstructionsSegmentsOfManyKernels) {
+    constexpr uint32_t numSymbols = 64u;
+    constexpr uint32_t relocationsPerKernel = 1024u;
+    constexpr size_t isaSizePerKernel = relocationsPerKernel * sizeof(uint64_t);
+
+    for (uint32_t numKernels : {32u, 256u}) {
+        WhiteBox<LinkerInput> linkerInput;
+        linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+        linkerInput.textRelocations.resize(numKernels);
+
+        std::vector<KernelDescriptor> kernelDescriptorsStorage(numKernels);
+        Linker::KernelDescriptorsT kernelDescriptors;
+        std::vector<std::vector<uint64_t>> isa(numKernels);
+        Linker::PatchableSegments segmentsToPatch(numKernels);
+        for (uint32_t kernelId = 0u; kernelId < numKernels; kernelId++) {
+            for (uint32_t relocationId = 0u; relocationId < relocationsPerKernel; relocationId++) {
+                LinkerInput::RelocationInfo relocation;
+                relocation.offset = relocationId * sizeof(uint64_t);
+                relocation.type = LinkerInput::RelocationInfo::Type::Address;
+                relocation.relocationSegment = SegmentType::Instructions;
+                relocation.symbolName = "global_" + std::to_string((kernelId + relocationId) % numSymbols);
+                linkerInput.textRelocations[kernelId].push_back(relocation);
+            }
+            kernelDescriptors.push_back(&kernelDescriptorsStorage[kernelId]);
+            isa[kernelId].resize(relocationsPerKernel);
+            segmentsToPatch[kernelId].hostPointer = isa[kernelId].data();
+            segmentsToPatch[kernelId].segmentSize = isaSizePerKernel;
+        }
+
+        for (uint32_t workersCount : {1u, 2u, 4u, 8u}) {
+            WhiteBox<Linker> linker(linkerInput, workersCount);
+            for (uint32_t symbolId = 0u; symbolId < numSymbols; symbolId++) {
+                linker.relocatedSymbols["global_" + std::to_string(symbolId)].gpuAddress = 0x10000 * (symbolId + 1);
+            }
+
+            Linker::UnresolvedExternals unresolvedExternals;
+            auto seconds = Benchmark::measure(16u, [&]() {
+                unresolvedExternals.clear();
+                linker.patchInstructionsSegments(segmentsToPatch, unresolvedExternals, kernelDescriptors);
+            });
+            EXPECT_TRUE(unresolvedExternals.empty());
+            const auto lastKernelId = numKernels - 1;
+            EXPECT_EQ(0x10000u * (lastKernelId % numSymbols + 1), isa[lastKernelId][0]);
+
+            auto variant = std::to_string(numKernels) + " kernels, " + std::to_string(workersCount) + " workers";
+            Benchmark::report("linker ISA patching", variant.c_str(), seconds, numKernels * isaSizePerKernel);
+        }
+    }
+}
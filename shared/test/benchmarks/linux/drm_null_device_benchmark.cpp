@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/command_encoder.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/os_interface/linux/drm_gem_close_worker.h"
+#include "shared/source/os_interface/linux/drm_null_device.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/mocks/mock_allocation_properties.h"
+#include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
+#include "shared/test/common/os_interface/linux/drm_command_stream_fixture.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+
+// Null device accepts every ioctl without doing any work, so only driver side cost of submission is measured
+class BenchmarkDrmNullDevice : public DrmNullDevice {
+  public:
+    BenchmarkDrmNullDevice(RootDeviceEnvironment &rootDeviceEnvironment) : DrmNullDevice(std::make_unique<HwDeviceIdDrm>(mockFd, mockPciPath), rootDeviceEnvironment) {
+        setupIoctlHelper(rootDeviceEnvironment.getHardwareInfo()->platform.eProductFamily);
+        createVirtualMemoryAddressSpace(HwHelper::getSubDevicesCount(rootDeviceEnvironment.getHardwareInfo()));
+    }
+
+    bool isVmBindAvailable() override {
+        return false;
+    }
+};
+
+} // namespace
+
+using DrmNullDeviceBenchmark = DrmCommandStreamEnhancedTemplate<BenchmarkDrmNullDevice>;
+
+// Replays submissions with unchanged residency, exec objects are either refilled on every exec or reused from previous one
+HWTEST_TEMPLATED_F(DrmNullDeviceBenchmark, FlushUnchangedResidencyWithAndWithoutExecObjectsCache) {
+    constexpr size_t submissions = 2000u;
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    EncodeNoop<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    std::vector<GraphicsAllocation *> graphicsAllocations;
+    for (auto boCount : {16u, 128u, 512u}) {
+        while (graphicsAllocations.size() < boCount) {
+            auto graphicsAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+            csr->makeResident(*graphicsAllocation);
+            graphicsAllocations.push_back(graphicsAllocation);
+        }
+
+        for (bool useExecObjectsCache : {false, true}) {
+            testedCsr->useExecObjectsCache = useExecObjectsCache;
+            bool success = true;
+            size_t reusedExecObjects = 0u;
+            auto seconds = Benchmark::measure(submissions, [&]() {
+                success &= (SubmissionStatus::SUCCESS == csr->flush(batchBuffer, csr->getResidencyAllocations()));
+                reusedExecObjects += testedCsr->lastReusedExecObjectsCount;
+            });
+            EXPECT_TRUE(success);
+            if (useExecObjectsCache) {
+                EXPECT_LE(boCount * (submissions - 1), reusedExecObjects);
+            } else {
+                EXPECT_EQ(0u, reusedExecObjects);
+            }
+
+            auto variant = std::to_string(boCount) + " BOs, " + (useExecObjectsCache ? "exec objects cache" : "no exec objects cache");
+            Benchmark::reportOperations("drm flush", variant.c_str(), seconds, boCount + 1);
+        }
+    }
+
+    for (auto graphicsAllocation : graphicsAllocations) {
+        mm->freeGraphicsMemory(graphicsAllocation);
+    }
+    mm->freeGraphicsMemory(commandBuffer);
+}
+
+// Tears down many buffer objects through gem close worker, producers push while worker drains batches
+HWTEST_TEMPLATED_F(DrmNullDeviceBenchmark, CloseManyBufferObjectsWithGemCloseWorker) {
+    for (uint32_t boCount : {1000u, 10000u, 50000u}) {
+        auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+        auto seconds = Benchmark::measure(1u, [&]() {
+            for (uint32_t i = 0; i < boCount; i++) {
+                worker->push(new BufferObject(mock, CommonConstants::unsupportedPatIndex, static_cast<int>(i + 1), 0, 1));
+            }
+            worker->close(true);
+        });
+        EXPECT_TRUE(worker->isEmpty());
+
+        auto statistics = worker->getBatchStatistics();
+        EXPECT_EQ(boCount, statistics.closedCount);
+
+        auto variant = std::to_string(boCount) + " BOs, " + std::to_string(statistics.batchCount) + " batches, max batch " + std::to_string(statistics.maxBatchSize);
+        Benchmark::reportOperations("gem close worker teardown", variant.c_str(), seconds, boCount);
+    }
+}
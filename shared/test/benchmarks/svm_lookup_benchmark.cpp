@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Cycles pointer lookups over a working set of SVM allocations while unrelated allocations are
+// created and freed every few lookups, the way kernel arguments are resolved while the application
+// keeps allocating temporaries. Reported time includes the churn, hit rate is the share of lookups
+// served by the lock-free cache without taking the allocations map lock.
+TEST(SvmLookupBenchmark, GetSvmAllocInWorkingSetUnderAllocationChurn) {
+    constexpr size_t lookups = 100000u;
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    executionEnvironment.initGmm();
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    MockSVMAllocsManager svmManager(&memoryManager, false);
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+
+    for (size_t workingSetSize : {4u, 8u, 20u, 48u}) {
+        std::vector<void *> workingSet;
+        for (size_t i = 0; i < workingSetSize; i++) {
+            workingSet.push_back(svmManager.createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields));
+            ASSERT_NE(nullptr, workingSet.back());
+        }
+
+        for (size_t lookupsPerFree : {0u, 100u, 10u, 2u}) {
+            size_t lookup = 0u;
+            size_t hits = 0u;
+            bool success = true;
+            auto seconds = Benchmark::measure(lookups, [&]() {
+                if ((lookupsPerFree != 0u) && (lookup % lookupsPerFree == 0u)) {
+                    svmManager.freeSVMAlloc(svmManager.createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields));
+                }
+                auto ptr = ptrOffset(workingSet[lookup % workingSetSize], (lookup * MemoryConstants::cacheLineSize) % MemoryConstants::pageSize);
+                auto svmData = svmManager.SVMAllocs.getFromLookupCache(ptr);
+                if (svmData) {
+                    hits++;
+                } else {
+                    svmData = svmManager.getSVMAlloc(ptr);
+                }
+                success &= (nullptr != svmData) && (workingSet[lookup % workingSetSize] == reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+                lookup++;
+            });
+            EXPECT_TRUE(success);
+
+            auto variant = std::to_string(workingSetSize) + " allocations, " +
+                           (lookupsPerFree ? "free every " + std::to_string(lookupsPerFree) + " lookups" : std::string("no frees")) +
+                           ", hit rate " + std::to_string(hits * 100u / lookups) + "%";
+            Benchmark::reportOperations("svm lookup", variant.c_str(), seconds * lookups, lookups);
+        }
+
+        for (auto ptr : workingSet) {
+            svmManager.freeSVMAlloc(ptr);
+        }
+    }
+}
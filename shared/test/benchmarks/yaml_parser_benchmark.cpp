@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+#include "shared/test/benchmarks/benchmark_helper.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+
+using namespace NEO;
+
+namespace {
+
+// Layout follows .ze_info emitted by IGC for kernels with many explicit arguments
+std::string generateZeInfo(size_t numKernels) {
+    std::string zeInfo = "version : '1.11'\nkernels:\n";
+    for (size_t kernelId = 0U; kernelId < numKernels; ++kernelId) {
+        zeInfo += "  - name : kernel_" + std::to_string(kernelId) + "\n";
+        zeInfo += "    execution_env:\n";
+        zeInfo += "      grf_count: 128\n";
+        zeInfo += "      has_no_stateless_write: true\n";
+        zeInfo += "      simd_size: 32\n";
+        zeInfo += "      required_work_group_size: [ 8, 1, 1 ]\n";
+        zeInfo += "    payload_arguments:\n";
+        for (size_t argId = 0U; argId < 16U; ++argId) {
+            zeInfo += "      - arg_type: arg_bypointer\n";
+            zeInfo += "        offset: " + std::to_string(argId * 8) + "\n";
+            zeInfo += "        size: 8\n";
+            zeInfo += "        arg_index: " + std::to_string(argId) + "\n";
+            zeInfo += "        addrmode: stateless\n";
+            zeInfo += "        addrspace: global\n";
+            zeInfo += "        access_type: readwrite\n";
+        }
+        zeInfo += "    binding_table_indices:\n";
+        zeInfo += "      - bti_value: 0\n";
+        zeInfo += "        arg_index: 0\n";
+    }
+    return zeInfo;
+}
+
+} // namespace
+
+TEST(YamlParserBenchmark, ClassifyTokenizeAndParseLargeZeInfo) {
+    for (size_t numKernels : {16U, 256U, 2048U}) {
+        auto zeInfo = generateZeInfo(numKernels);
+        auto variant = std::to_string(numKernels) + " kernels, " + std::to_string(zeInfo.size() / 1024) + " KB";
+        auto iterations = 2048U / numKernels * 4U;
+
+        Yaml::TextClassification classification;
+        auto seconds = Benchmark::measure(iterations, [&]() { classification = Yaml::classifyTextScalar(zeInfo); });
+        Benchmark::report("yaml scalar classification", variant.c_str(), seconds, zeInfo.size());
+        EXPECT_LT(0U, classification.numLines);
+
+        seconds = Benchmark::measure(iterations, [&]() { classification = Yaml::TextClassifier::classify(zeInfo); });
+        Benchmark::report("yaml dispatched classification", variant.c_str(), seconds, zeInfo.size());
+        EXPECT_LT(0U, classification.numLines);
+
+        bool success = true;
+        seconds = Benchmark::measure(iterations, [&]() {
+            Yaml::LinesCache lines;
+            Yaml::TokensCache tokens;
+            std::string errors;
+            std::string warnings;
+            success &= Yaml::tokenize(zeInfo, lines, tokens, errors, warnings);
+        });
+        Benchmark::report("yaml tokenize", variant.c_str(), seconds, zeInfo.size());
+        EXPECT_TRUE(success);
+
+        // Same tokenization with caches pre-sized from classification pass instead of grown from position based estimates
+        seconds = Benchmark::measure(iterations, [&]() {
+            Yaml::LinesCache lines;
+            Yaml::TokensCache tokens;
+            std::string errors;
+            std::string warnings;
+            auto textClassification = Yaml::TextClassifier::classify(zeInfo);
+            lines.reserve(textClassification.numLines + 1);
+            tokens.reserve(textClassification.numTokensEstimate + 1);
+            success &= Yaml::tokenize(zeInfo, lines, tokens, errors, warnings);
+        });
+        Benchmark::report("yaml tokenize with pre-sized caches", variant.c_str(), seconds, zeInfo.size());
+        EXPECT_TRUE(success);
+
+        seconds = Benchmark::measure(iterations, [&]() {
+            Yaml::YamlParser parser;
+            std::string errors;
+            std::string warnings;
+            success &= parser.parse(zeInfo, errors, warnings);
+        });
+        Benchmark::report("yaml parse", variant.c_str(), seconds, zeInfo.size());
+        EXPECT_TRUE(success);
+    }
+}
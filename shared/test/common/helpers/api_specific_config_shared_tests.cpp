@@ -31,6 +31,10 @@ bool ApiSpecificConfig::isDeviceAllocationCacheEnabled() {
     return false;
 }
 
+bool ApiSpecificConfig::isHostAllocationCacheEnabled() {
+    return false;
+}
+
 ApiSpecificConfig::ApiType ApiSpecificConfig::getApiType() {
     return apiTypeForUlts;
 }
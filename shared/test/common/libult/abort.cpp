@@ -7,10 +7,21 @@
 
 #include "shared/source/helpers/abort.h"
 
+#include <atomic>
 #include <exception>
 
 namespace NEO {
+static std::atomic<AbortExecutionHandler> abortExecutionHandler{nullptr};
+
+void setAbortExecutionHandler(AbortExecutionHandler handler) {
+    abortExecutionHandler.store(handler);
+}
+
 void abortExecution() {
+    auto handler = abortExecutionHandler.load();
+    if (handler) {
+        handler();
+    }
     throw std::exception();
 }
 } // namespace NEO
@@ -27,10 +27,10 @@ class MockBufferObject : public BufferObject {
     MockBufferObject(Drm *drm) : BufferObject(drm, CommonConstants::unsupportedPatIndex, 0, 0, 1) {
     }
     int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId,
-             BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, uint32_t completionValue) override {
+             BufferObject *const residency[], size_t residencyCount, ExecObject *execObjectsStorage, uint64_t completionGpuAddress, uint32_t completionValue, bool residencyExecObjectsPrepared) override {
         passedExecParams.push_back({completionGpuAddress, completionValue});
         return BufferObject::exec(used, startOffset, flags, requiresCoherency, osContext, vmHandleId, drmContextId,
-                                  residency, residencyCount, execObjectsStorage, completionGpuAddress, completionValue);
+                                  residency, residencyCount, execObjectsStorage, completionGpuAddress, completionValue, residencyExecObjectsPrepared);
     }
 };
 
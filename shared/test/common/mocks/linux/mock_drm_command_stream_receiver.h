@@ -33,10 +33,12 @@ class TestedDrmCommandStreamReceiver : public DrmCommandStreamReceiver<GfxFamily
     using CommandStreamReceiver::useNewResourceImplicitFlush;
     using CommandStreamReceiver::useNotifyEnableForPostSync;
     using DrmCommandStreamReceiver<GfxFamily>::exec;
+    using DrmCommandStreamReceiver<GfxFamily>::execObjectsCaches;
+    using DrmCommandStreamReceiver<GfxFamily>::lastReusedExecObjectsCount;
     using DrmCommandStreamReceiver<GfxFamily>::residency;
     using DrmCommandStreamReceiver<GfxFamily>::useContextForUserFenceWait;
     using DrmCommandStreamReceiver<GfxFamily>::useUserFenceWait;
-    using DrmCommandStreamReceiver<GfxFamily>::execObjectsStorage;
+    using DrmCommandStreamReceiver<GfxFamily>::useExecObjectsCache;
     using CommandStreamReceiverHw<GfxFamily>::directSubmission;
     using CommandStreamReceiverHw<GfxFamily>::blitterDirectSubmission;
     using CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiver::lastSentSliceCount;
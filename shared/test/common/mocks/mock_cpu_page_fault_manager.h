@@ -37,21 +37,30 @@ class MockPageFaultManager : public PageFaultManager {
         transferToCpuAddress = ptr;
         transferToCpuSize = size;
     }
-    void transferToGpu(void *ptr, void *cmdQ) override {
+    void transferToGpu(void *ptr, size_t size, void *allocPtr, void *cmdQ) override {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
+        transferToGpuSize = size;
     }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
+    void setAubWritableRange(void *ptr, size_t offset, size_t size, SVMAllocsManager *unifiedMemoryManager) override {
+        setAubWritableRangeCalled++;
+        aubWritableRangeOffset = offset;
+        aubWritableRangeSize = size;
+    }
     void baseAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
         PageFaultManager::setAubWritable(writable, ptr, unifiedMemoryManager);
     }
+    void baseAubWritableRange(void *ptr, size_t offset, size_t size, SVMAllocsManager *unifiedMemoryManager) {
+        PageFaultManager::setAubWritableRange(ptr, offset, size, unifiedMemoryManager);
+    }
     void baseCpuTransfer(void *ptr, size_t size, void *cmdQ) {
         PageFaultManager::transferToCpu(ptr, size, cmdQ);
     }
-    void baseGpuTransfer(void *ptr, void *cmdQ) {
-        PageFaultManager::transferToGpu(ptr, cmdQ);
+    void baseGpuTransfer(void *ptr, size_t size, void *allocPtr, void *cmdQ) {
+        PageFaultManager::transferToGpu(ptr, size, allocPtr, cmdQ);
     }
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override {}
 
@@ -72,13 +81,17 @@ class MockPageFaultManager : public PageFaultManager {
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
+    int setAubWritableRangeCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
+    size_t aubWritableRangeOffset = 0;
+    size_t aubWritableRangeSize = 0;
     bool isAubWritable = true;
 };
 
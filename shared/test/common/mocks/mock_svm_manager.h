@@ -8,8 +8,15 @@
 #pragma once
 #include "shared/source/memory_manager/unified_memory_manager.h"
 namespace NEO {
+struct MockMapBasedAllocationTracker : public SVMAllocsManager::MapBasedAllocationTracker {
+    using SVMAllocsManager::MapBasedAllocationTracker::getLookupCacheSetIndex;
+    using SVMAllocsManager::MapBasedAllocationTracker::LookupCache;
+    using SVMAllocsManager::MapBasedAllocationTracker::removedRangesLogSize;
+};
+
 struct MockSVMAllocsManager : public SVMAllocsManager {
   public:
+    using SVMAllocsManager::isHostAllocationCacheable;
     using SVMAllocsManager::memoryManager;
     using SVMAllocsManager::mtxForIndirectAccess;
     using SVMAllocsManager::multiOsContextSupport;
@@ -18,5 +25,8 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::svmMapOperations;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
+    using SVMAllocsManager::usmHostAllocationsCache;
+    using SVMAllocsManager::usmHostAllocationsCacheEnabled;
+    using SVMAllocsManager::usmSharedAllocationsCache;
 };
 } // namespace NEO
@@ -853,6 +853,51 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenGraphic
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
 
+HWTEST_F(AubCommandStreamReceiverTests, givenAllocationWithAubWritableRangeWhenWriteMemoryIsCalledThenOnlyRangeIsDumpedAndAllocationIsMadeNonAubWritable) {
+    std::unique_ptr<MemoryManager> memoryManager(nullptr);
+    std::unique_ptr<AUBCommandStreamReceiverHw<FamilyType>> aubCsr(new AUBCommandStreamReceiverHw<FamilyType>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield()));
+    memoryManager.reset(new OsAgnosticMemoryManager(*pDevice->executionEnvironment));
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), 4 * MemoryConstants::pageSize, AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(4 * MemoryConstants::pageSize, aubCsr->getTotalDumpedBytes());
+    EXPECT_FALSE(aubCsr->isAubWritable(*gfxAllocation));
+
+    gfxAllocation->setAubWritableRange(2 * MemoryConstants::pageSize + 4, 8, GraphicsAllocation::defaultBank);
+    EXPECT_TRUE(aubCsr->isAubWritable(*gfxAllocation));
+    EXPECT_TRUE(aubCsr->writeMemory(*gfxAllocation));
+    EXPECT_EQ(5 * MemoryConstants::pageSize, aubCsr->getTotalDumpedBytes());
+    EXPECT_FALSE(aubCsr->isAubWritable(*gfxAllocation));
+    EXPECT_EQ(nullptr, aubCsr->getAubWritableRanges(*gfxAllocation));
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenProcessResidencyIsCalledThenDumpedBytesInLastFlushAreCounted) {
+    std::unique_ptr<MemoryManager> memoryManager(nullptr);
+    std::unique_ptr<AUBCommandStreamReceiverHw<FamilyType>> aubCsr(new AUBCommandStreamReceiverHw<FamilyType>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield()));
+    memoryManager.reset(new OsAgnosticMemoryManager(*pDevice->executionEnvironment));
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), 4 * MemoryConstants::pageSize, AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+
+    ResidencyContainer allocationsForResidency = {gfxAllocation};
+    aubCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(4 * MemoryConstants::pageSize, aubCsr->getDumpedBytesInLastFlush());
+
+    gfxAllocation->setAubWritableRange(0, MemoryConstants::pageSize + 1, GraphicsAllocation::defaultBank);
+    aubCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, aubCsr->getDumpedBytesInLastFlush());
+
+    aubCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(0u, aubCsr->getDumpedBytesInLastFlush());
+    EXPECT_EQ(6 * MemoryConstants::pageSize, aubCsr->getTotalDumpedBytes());
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenGraphicsAllocationSizeIsZeroThenWriteMemoryIsNotAllowed) {
     std::unique_ptr<AUBCommandStreamReceiverHw<FamilyType>> aubCsr(new AUBCommandStreamReceiverHw<FamilyType>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield()));
     MockGraphicsAllocation gfxAllocation((void *)0x1234, 0);
@@ -7,6 +7,7 @@
 
 #include "shared/source/aub_mem_dump/page_table_entry_bits.h"
 #include "shared/source/command_stream/aub_command_stream_receiver_hw.h"
+#include "shared/source/helpers/abort.h"
 #include "shared/source/helpers/hardware_context_controller.h"
 #include "shared/source/helpers/neo_driver_version.h"
 #include "shared/source/os_interface/os_context.h"
@@ -27,8 +28,10 @@
 #include "gtest/gtest.h"
 #include "sys_calls.h"
 
+#include <atomic>
 #include <fstream>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
@@ -994,3 +997,249 @@ HWTEST_F(AubFileStreamTests, givenGenerateAubFilePerProcessIdDebugFlagAndAubComm
     strExtendedFileName << "_1_aubfile_PID_" << SysCalls::getProcessId() << ".aub";
     EXPECT_NE(std::string::npos, fullName.find(strExtendedFileName.str()));
 }
+
+namespace {
+
+std::vector<char> readAubFile(const std::string &fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void writeSampleAubRecords(AubMemDump::AubFileStream &stream, const std::string &fileName) {
+    std::vector<uint8_t> memory(3 * MemoryConstants::pageSize + 3);
+    for (size_t i = 0; i < memory.size(); i++) {
+        memory[i] = static_cast<uint8_t>(i);
+    }
+
+    stream.open(fileName.c_str());
+    stream.init(0, 0);
+    stream.addComment("async writer test");
+    stream.writeMemory(0x10000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+    stream.flush();
+    stream.writeMMIOImpl(0x2000, 0x1234);
+    stream.registerPoll(0x2034, 0xffff, 0x1, false, 1);
+    stream.expectMemory(0x10000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    stream.close();
+}
+
+} // namespace
+
+TEST(AubFileStreamWriterTests, givenBackgroundWriterWhenRecordsAreWrittenThenFileIsByteIdenticalToSynchronousWrites) {
+    DebugManagerStateRestore stateRestore;
+    std::string syncFileName = "aub_file_stream_sync.aub";
+    std::string asyncFileName = "aub_file_stream_async.aub";
+
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(0);
+    {
+        AubMemDump::AubFileStream stream;
+        writeSampleAubRecords(stream, syncFileName);
+    }
+
+    // buffer smaller than single memory write record forces multiple hand-overs per record
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(64);
+    {
+        AubMemDump::AubFileStream stream;
+        writeSampleAubRecords(stream, asyncFileName);
+    }
+
+    auto syncContents = readAubFile(syncFileName);
+    auto asyncContents = readAubFile(asyncFileName);
+    std::remove(syncFileName.c_str());
+    std::remove(asyncFileName.c_str());
+
+    EXPECT_LT(3 * MemoryConstants::pageSize, syncContents.size());
+    EXPECT_EQ(syncContents, asyncContents);
+}
+
+struct AubFileStreamWithWriterControl : public AubMemDump::AubFileStream {
+    using AubMemDump::AubFileStream::waitForWriterIdle;
+
+    void writeToFile(const char *data, size_t size, bool flushFile) override {
+        writerEntered = true;
+        while (blockWriter) {
+            std::this_thread::yield();
+        }
+        AubMemDump::AubFileStream::writeToFile(data, size, flushFile);
+        if (flushFile) {
+            fileFlushes++;
+        }
+    }
+
+    std::atomic<bool> blockWriter{false};
+    std::atomic<bool> writerEntered{false};
+    std::atomic<uint32_t> fileFlushes{0u};
+};
+
+TEST(AubFileStreamWriterTests, givenBackgroundWriterWhenFlushIsCalledThenAllRecordsAreInFileOnceWriterIsIdle) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(-1);
+    std::string fileName = "aub_file_stream_flush.aub";
+
+    AubFileStreamWithWriterControl stream;
+    stream.open(fileName.c_str());
+    ASSERT_TRUE(stream.isOpen());
+
+    uint32_t value = 0xabcd;
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    stream.flush();
+    stream.waitForWriterIdle();
+    EXPECT_EQ(1u, stream.fileFlushes.load());
+    EXPECT_EQ(sizeof(value), readAubFile(fileName).size());
+
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    stream.close();
+    EXPECT_FALSE(stream.isOpen());
+    EXPECT_EQ(2 * sizeof(value), readAubFile(fileName).size());
+
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamWriterTests, givenBusyBackgroundWriterWhenFlushIsCalledThenItReturnsBeforeRecordsAreWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(-1);
+    std::string fileName = "aub_file_stream_flush_async.aub";
+
+    AubFileStreamWithWriterControl stream;
+    stream.blockWriter = true;
+    stream.open(fileName.c_str());
+    ASSERT_TRUE(stream.isOpen());
+
+    uint32_t value = 0xabcd;
+    for (uint32_t i = 0; i < 3; i++) {
+        stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        stream.flush();
+    }
+    while (!stream.writerEntered) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(0u, stream.fileFlushes.load());
+    EXPECT_EQ(0u, readAubFile(fileName).size());
+
+    stream.blockWriter = false;
+    stream.close();
+    EXPECT_EQ(3u, stream.fileFlushes.load());
+    EXPECT_EQ(3 * sizeof(value), readAubFile(fileName).size());
+
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamWriterTests, givenBusyBackgroundWriterWhenCheckingIsOpenFromAnotherThreadThenStreamIsReportedOpenUntilClosed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(-1);
+    std::string fileName = "aub_file_stream_is_open.aub";
+
+    AubFileStreamWithWriterControl stream;
+    EXPECT_FALSE(stream.isOpen());
+    stream.blockWriter = true;
+    stream.open(fileName.c_str());
+
+    uint32_t value = 0xabcd;
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    stream.flush();
+    while (!stream.writerEntered) {
+        std::this_thread::yield();
+    }
+    bool isOpenInOtherThread = false;
+    std::thread([&]() { isOpenInOtherThread = stream.isOpen(); }).join();
+    EXPECT_TRUE(isOpenInOtherThread);
+
+    stream.blockWriter = false;
+    stream.close();
+    EXPECT_FALSE(stream.isOpen());
+
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamWriterTests, givenSynchronousFlushEnabledWhenFlushIsCalledThenRecordsAreInFileWhenItReturns) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(-1);
+    DebugManager.flags.AUBDumpFileWriterSynchronousFlush.set(1);
+    std::string fileName = "aub_file_stream_flush_sync.aub";
+
+    AubFileStreamWithWriterControl stream;
+    stream.blockWriter = true;
+    stream.open(fileName.c_str());
+    ASSERT_TRUE(stream.isOpen());
+
+    std::thread writerUnblocker([&]() {
+        while (!stream.writerEntered) {
+            std::this_thread::yield();
+        }
+        stream.blockWriter = false;
+    });
+    uint32_t value = 0xabcd;
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    stream.flush();
+    EXPECT_EQ(1u, stream.fileFlushes.load());
+    EXPECT_EQ(sizeof(value), readAubFile(fileName).size());
+
+    writerUnblocker.join();
+    stream.close();
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamWriterTests, givenRecordsNotFlushedWhenExecutionIsAbortedThenTheyAreWrittenToFile) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(-1);
+    std::string fileName = "aub_file_stream_abort.aub";
+
+    AubFileStreamWithWriterControl stream;
+    stream.open(fileName.c_str());
+    ASSERT_TRUE(stream.isOpen());
+
+    uint32_t value = 0xabcd;
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    EXPECT_THROW(abortExecution(), std::exception);
+    EXPECT_EQ(1u, stream.fileFlushes.load());
+    EXPECT_EQ(sizeof(value), readAubFile(fileName).size());
+
+    stream.close();
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamWriterTests, givenRecordsNotFlushedWhenStreamIsDestroyedThenTheyAreWrittenToFile) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpFileWriterBufferSize.set(-1);
+    std::string fileName = "aub_file_stream_teardown.aub";
+
+    uint32_t value = 0xabcd;
+    {
+        AubMemDump::AubFileStream stream;
+        stream.open(fileName.c_str());
+        ASSERT_TRUE(stream.isOpen());
+        for (uint32_t i = 0; i < 3; i++) {
+            stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+            stream.flush();
+        }
+        stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+    EXPECT_EQ(4 * sizeof(value), readAubFile(fileName).size());
+
+    std::remove(fileName.c_str());
+}
+
+struct AubFileStreamWithWriteMemoryCapture : public MockAubFileStream {
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        writtenRanges.push_back({physAddress, size});
+    }
+    std::vector<std::pair<uint64_t, size_t>> writtenRanges;
+};
+
+HWTEST_F(AubFileStreamTests, givenPhysicallyContiguousAllocationWhenWriteMemoryIsCalledThenPagesAreWrittenAsSingleRecord) {
+    auto captureStream = std::make_unique<AubFileStreamWithWriteMemoryCapture>();
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+    aubCsr->initializeEngine();
+    aubCsr->stream = captureStream.get();
+
+    uint64_t gpuAddress = 0x40000000;
+    size_t size = 16 * MemoryConstants::pageSize;
+    std::vector<uint8_t> memory(size);
+    auto physAddress = aubCsr->ppgtt->map(static_cast<uintptr_t>(gpuAddress), size, PageTableEntry::presentBit, MemoryBanks::MainBank);
+
+    aubCsr->writeMemory(gpuAddress, memory.data(), size, MemoryBanks::MainBank, PageTableEntry::presentBit);
+
+    ASSERT_EQ(1u, captureStream->writtenRanges.size());
+    EXPECT_EQ(physAddress, captureStream->writtenRanges[0].first);
+    EXPECT_EQ(size, captureStream->writtenRanges[0].second);
+}
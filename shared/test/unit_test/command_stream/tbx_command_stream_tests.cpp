@@ -180,6 +180,31 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCa
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+HWTEST_F(TbxCommandStreamTests, givenGraphicsAllocationWithTbxWritableRangeWhenProcessResidencyIsCalledThenOnlyRangeIsSentAndCounted) {
+    TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
+    tbxCsr->initializeEngine();
+    MemoryManager *memoryManager = tbxCsr->getMemoryManager();
+    ASSERT_NE(nullptr, memoryManager);
+
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pCommandStreamReceiver->getRootDeviceIndex(), 4 * MemoryConstants::pageSize, AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+    ASSERT_NE(nullptr, graphicsAllocation);
+
+    auto totalDumpedBytes = tbxCsr->getTotalDumpedBytes();
+    ResidencyContainer allocationsForResidency = {graphicsAllocation};
+    tbxCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(4 * MemoryConstants::pageSize, tbxCsr->getDumpedBytesInLastFlush());
+    EXPECT_FALSE(tbxCsr->isTbxWritable(*graphicsAllocation));
+
+    graphicsAllocation->setTbxWritableRange(3 * MemoryConstants::pageSize, 16, GraphicsAllocation::defaultBank);
+    EXPECT_TRUE(tbxCsr->isTbxWritable(*graphicsAllocation));
+    tbxCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr->getDumpedBytesInLastFlush());
+    EXPECT_EQ(totalDumpedBytes + 5 * MemoryConstants::pageSize, tbxCsr->getTotalDumpedBytes());
+    EXPECT_FALSE(tbxCsr->isTbxWritable(*graphicsAllocation));
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
 HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCalledWithGraphicsAllocationThatIsOnlyOneTimeWriteableButAlreadyWrittenThenGraphicsAllocationIsNotUpdated) {
     TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
     tbxCsr->initializeEngine();
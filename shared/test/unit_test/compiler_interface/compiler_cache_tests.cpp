@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,9 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/device_binary_format/zeinfo_blob.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
@@ -15,15 +17,21 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/libult/global_environment.h"
+#include "shared/test/common/mocks/mock_cif.h"
+#include "shared/test/common/mocks/mock_compiler_interface.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_io_functions.h"
+#include "shared/test/common/mocks/mock_modules_zebin.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "os_inc.h"
 
 #include <array>
+#include <atomic>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
@@ -34,16 +42,25 @@ class CompilerCacheMock : public CompilerCache {
 
     bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
         cacheInvoked++;
+        cachedHashes.push_back(kernelFileHash);
+        cachedBinaries.emplace_back(pBinary, pBinary + binarySize);
         return cacheResult;
     }
 
-    std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
-        return loadResult ? std::unique_ptr<char[]>{new char[1]} : nullptr;
+    CompilerCacheMemoryTier::BinaryT loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        loadedHashes.push_back(kernelFileHash);
+        cachedBinarySize = loadResult ? loadedBinarySize : 0u;
+        return loadResult ? loadedBinary : nullptr;
     }
 
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
+    std::vector<std::string> cachedHashes;
+    std::vector<std::vector<char>> cachedBinaries;
     bool loadResult = false;
+    CompilerCacheMemoryTier::BinaryT loadedBinary{new char[1]};
+    size_t loadedBinarySize = 1u;
+    std::vector<std::string> loadedHashes;
 };
 
 TEST(HashGeneration, givenMisalignedBufferWhenPassedToUpdateFunctionThenProperPtrDataIsUsed) {
@@ -223,6 +240,25 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, GivenDifferentSpecConstantsWhenGettingCachedFileNameThenDifferentHashesAreReturned) {
+    CompilerCache cache(CompilerCacheConfig{});
+    auto src = "__kernel k() {}";
+    ArrayRef<const char> input(src, strlen(src));
+
+    const char specConstants1[] = {1, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0};
+    const char specConstants2[] = {1, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0};
+
+    auto hashWithoutSpecConstants = cache.getCachedFileName(*defaultHwInfo, input, {}, {});
+    auto hashWithEmptySpecConstants = cache.getCachedFileName(*defaultHwInfo, input, {}, {}, {});
+    auto hash1 = cache.getCachedFileName(*defaultHwInfo, input, {}, {}, ArrayRef<const char>(specConstants1, sizeof(specConstants1)));
+    auto hash2 = cache.getCachedFileName(*defaultHwInfo, input, {}, {}, ArrayRef<const char>(specConstants2, sizeof(specConstants2)));
+
+    EXPECT_EQ(hashWithoutSpecConstants, hashWithEmptySpecConstants);
+    EXPECT_NE(hashWithoutSpecConstants, hash1);
+    EXPECT_NE(hashWithoutSpecConstants, hash2);
+    EXPECT_NE(hash1, hash2);
+}
+
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.BinaryCacheTrace.set(true);
@@ -436,3 +472,581 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+TEST(CompilerInterfaceCachedTests, givenDifferentSpecConstantsWhenBuildingThenDifferentCacheEntriesAreLookedUp) {
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+
+    auto src = "spirv";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    auto cache = new CompilerCacheMock();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+
+    TranslationOutput translationOutput;
+    inputArgs.specializedValues[1] = 5u;
+    inputArgs.specializedValues[2] = 7u;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+
+    inputArgs.specializedValues[1] = 6u;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+
+    inputArgs.specializedValues.clear();
+    inputArgs.specializedValues[2] = 7u;
+    inputArgs.specializedValues[1] = 5u;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+
+    ASSERT_EQ(3u, cache->loadedHashes.size());
+    EXPECT_NE(cache->loadedHashes[0], cache->loadedHashes[1]);
+    EXPECT_EQ(cache->loadedHashes[0], cache->loadedHashes[2]);
+}
+
+TEST(CompilerInterfaceCachedTests, givenCachedBinaryWhenLinkingThenIgcIsNotCalledAndSuccessIsReturned) {
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "elf";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+
+    TranslationOutput translationOutput;
+    inputArgs.allowCaching = true;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(1u, cache->loadedHashes.size());
+    EXPECT_EQ(cache->loadedBinary, translationOutput.deviceBinary.mem);
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenCachingNotAllowedWhenLinkingThenCacheIsNotUsed) {
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "elf";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+
+    TranslationOutput translationOutput;
+    inputArgs.allowCaching = false;
+    auto err = compilerInterface->link(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::LinkFailure, err);
+    EXPECT_EQ(0u, cache->loadedHashes.size());
+    EXPECT_EQ(0u, cache->cacheInvoked);
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenCachedZebinWhenLinkingThenZeInfoBlobIsLoadedFromSeparateCacheEntry) {
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::elf, IGC::CodeType::oclGenBin};
+
+    auto src = "elf";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    ZebinTestData::ValidEmptyProgram<> zebin;
+    auto cache = new CompilerCacheMock();
+    cache->loadResult = true;
+    cache->loadedBinary = CompilerCacheMemoryTier::BinaryT(makeCopy(zebin.storage.data(), zebin.storage.size()));
+    cache->loadedBinarySize = zebin.storage.size();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+
+    TranslationOutput translationOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->link(device, inputArgs, translationOutput));
+    ASSERT_EQ(2u, cache->loadedHashes.size());
+    EXPECT_EQ(cache->loadedHashes[0] + zeInfoBlobCacheKeySuffix.str(), cache->loadedHashes[1]);
+    EXPECT_EQ(cache->loadedBinary, translationOutput.deviceBinary.mem);
+    EXPECT_NE(nullptr, translationOutput.zeInfoBlob.mem);
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DisableZebinZeInfoBlob.set(true);
+    TranslationOutput translationOutputWithoutBlob;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->link(device, inputArgs, translationOutputWithoutBlob));
+    EXPECT_EQ(3u, cache->loadedHashes.size());
+    EXPECT_EQ(nullptr, translationOutputWithoutBlob.zeInfoBlob.mem);
+}
+
+TEST(CompilerInterfaceCachedTests, givenZebinWhenCachingDeviceBinaryThenZebinIsCachedUnchangedAndZeInfoBlobIsCachedAsSeparateEntry) {
+    MockDevice device{};
+    ZebinTestData::ValidEmptyProgram<> zebin;
+    auto cache = new CompilerCacheMock();
+    MockCompilerInterface compilerInterface;
+    compilerInterface.cache.reset(cache);
+
+    MockCIFBuffer deviceBinary;
+    deviceBinary.SetUnderlyingStorage(zebin.storage.data(), zebin.storage.size());
+    compilerInterface.cacheDeviceBinary(device, "zebin_hash", &deviceBinary);
+
+    ASSERT_EQ(2u, cache->cachedHashes.size());
+    EXPECT_EQ("zebin_hash", cache->cachedHashes[0]);
+    EXPECT_TRUE(std::equal(zebin.storage.begin(), zebin.storage.end(), cache->cachedBinaries[0].begin(), cache->cachedBinaries[0].end()));
+    EXPECT_EQ("zebin_hash" + zeInfoBlobCacheKeySuffix.str(), cache->cachedHashes[1]);
+    ASSERT_LE(sizeof(ZeInfoBlobHeader), cache->cachedBinaries[1].size());
+    EXPECT_EQ(ZeInfoBlobHeader::magic, reinterpret_cast<const ZeInfoBlobHeader *>(cache->cachedBinaries[1].data())->headerMagic);
+
+    const char notZebin[] = "patchtokens";
+    deviceBinary.SetUnderlyingStorage(notZebin, sizeof(notZebin));
+    compilerInterface.cacheDeviceBinary(device, "other_hash", &deviceBinary);
+    ASSERT_EQ(3u, cache->cachedHashes.size());
+    EXPECT_EQ("other_hash", cache->cachedHashes[2]);
+}
+
+class CompilerCacheEvictionMock : public CompilerCache {
+  public:
+    using CompilerCache::cacheSizeKnown;
+    using CompilerCache::evictCache;
+    using CompilerCache::knownCacheSize;
+
+    CompilerCacheEvictionMock(const CompilerCacheConfig &config) : CompilerCache(config) {}
+
+    std::vector<CacheEntryInfo> getCacheEntries() override {
+        getCacheEntriesCalled++;
+        return entries;
+    }
+
+    bool removeCacheEntry(const std::string &filePath) override {
+        removedEntries.push_back(filePath);
+        return true;
+    }
+
+    bool renameTempFileToProperName(const std::string &tempFilePath, const std::string &filePath) override {
+        renameCalled++;
+        if (renameResult) {
+            return CompilerCache::renameTempFileToProperName(tempFilePath, filePath);
+        }
+        return false;
+    }
+
+    std::vector<CacheEntryInfo> entries;
+    std::vector<std::string> removedEntries;
+    uint32_t getCacheEntriesCalled = 0u;
+    uint32_t renameCalled = 0u;
+    bool renameResult = true;
+};
+
+TEST(CompilerCacheTests, GivenCachedBinaryWhenLoadingThenSameDataIsReturned) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    CompilerCache cache(config);
+
+    const char binary[] = "some binary data";
+    EXPECT_TRUE(cache.cacheBinary("cache_roundtrip", binary, static_cast<uint32_t>(sizeof(binary))));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("cache_roundtrip", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), sizeof(binary)));
+
+    size_t fileSize = 0u;
+    auto fileData = loadDataFromFile("./cache_roundtrip.neo_test_cache", fileSize);
+    ASSERT_NE(nullptr, fileData);
+    EXPECT_EQ(sizeof(CompilerCacheEntryHeader) + sizeof(binary), fileSize);
+    auto header = reinterpret_cast<CompilerCacheEntryHeader *>(fileData.get());
+    EXPECT_EQ(CompilerCacheEntryHeader::magic, header->headerMagic);
+    EXPECT_EQ(CompilerCacheEntryHeader::currentVersion, header->version);
+    EXPECT_EQ(sizeof(binary), header->binarySize);
+    EXPECT_EQ(CompilerCache::computeChecksum(binary, sizeof(binary)), header->checksum);
+
+    std::remove("./cache_roundtrip.neo_test_cache");
+}
+
+TEST(CompilerCacheTests, GivenCacheEntryWithoutValidHeaderWhenLoadingThenNullIsReturnedAndEntryIsRemoved) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    CompilerCache cache(config);
+
+    const char legacyBinary[] = "binary without header";
+    writeDataToFile("./cache_no_header.neo_test_cache", legacyBinary, sizeof(legacyBinary));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("cache_no_header", size);
+    EXPECT_EQ(nullptr, loaded);
+    EXPECT_EQ(0u, size);
+    EXPECT_FALSE(fileExists("./cache_no_header.neo_test_cache"));
+}
+
+TEST(CompilerCacheTests, GivenTruncatedOrModifiedCacheEntryWhenLoadingThenNullIsReturnedAndEntryIsRemoved) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    CompilerCache cache(config);
+
+    const char binary[] = "some binary data";
+    for (auto truncate : {true, false}) {
+        EXPECT_TRUE(cache.cacheBinary("cache_corrupted", binary, static_cast<uint32_t>(sizeof(binary))));
+
+        size_t fileSize = 0u;
+        auto fileData = loadDataFromFile("./cache_corrupted.neo_test_cache", fileSize);
+        ASSERT_NE(nullptr, fileData);
+        if (truncate) {
+            fileSize -= 4;
+        } else {
+            fileData[fileSize - 1] ^= 0xff;
+        }
+        writeDataToFile("./cache_corrupted.neo_test_cache", fileData.get(), fileSize);
+
+        size_t size = 0u;
+        auto loaded = cache.loadCachedBinary("cache_corrupted", size);
+        EXPECT_EQ(nullptr, loaded);
+        EXPECT_EQ(0u, size);
+        EXPECT_FALSE(fileExists("./cache_corrupted.neo_test_cache"));
+    }
+}
+
+TEST(CompilerCacheTests, GivenEntryReplacedAfterBeingReportedCorruptedWhenLoadingThenValidEntryIsNotRemoved) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.mmapThreshold = 1u;
+
+    // reports the entry as corrupted the way a reader racing with a concurrent store would see it
+    struct StaleReadCache : public CompilerCache {
+        using CompilerCache::CompilerCache;
+        CompilerCacheMemoryTier::BinaryT mapCacheEntry(const std::string &filePath, size_t minFileSize, size_t &binarySize, bool &isCorrupted) override {
+            if (false == staleRead) {
+                return CompilerCache::mapCacheEntry(filePath, minFileSize, binarySize, isCorrupted);
+            }
+            binarySize = 0u;
+            isCorrupted = true;
+            return nullptr;
+        }
+        bool staleRead = true;
+    } cache(config);
+
+    const char binary[] = "some binary data";
+    EXPECT_TRUE(cache.cacheBinary("cache_replaced", binary, static_cast<uint32_t>(sizeof(binary))));
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("cache_replaced", size));
+    EXPECT_TRUE(fileExists("./cache_replaced.neo_test_cache"));
+
+    cache.staleRead = false;
+    auto loaded = cache.loadCachedBinary("cache_replaced", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+
+    std::remove("./cache_replaced.neo_test_cache");
+}
+
+TEST(CompilerCacheTests, GivenBinaryBiggerThanCacheSizeWhenCachingThenBinaryIsNotCached) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.cacheSize = sizeof(CompilerCacheEntryHeader) + 4;
+    CompilerCacheEvictionMock cache(config);
+
+    const char binary[] = "some binary data";
+    EXPECT_FALSE(cache.cacheBinary("cache_too_big", binary, static_cast<uint32_t>(sizeof(binary))));
+    EXPECT_EQ(0u, cache.getCacheEntriesCalled);
+    EXPECT_EQ(0u, cache.renameCalled);
+}
+
+TEST(CompilerCacheTests, GivenCacheBelowLimitWhenEvictingThenNothingIsRemovedAndSizeIsRemembered) {
+    CompilerCacheConfig config;
+    config.cacheSize = 100u;
+    CompilerCacheEvictionMock cache(config);
+    cache.entries = {{"a", 20u, 1u}, {"b", 30u, 2u}};
+
+    EXPECT_TRUE(cache.evictCache(10u));
+    EXPECT_EQ(1u, cache.getCacheEntriesCalled);
+    EXPECT_TRUE(cache.removedEntries.empty());
+    EXPECT_TRUE(cache.cacheSizeKnown);
+    EXPECT_EQ(50u, cache.knownCacheSize.load());
+
+    EXPECT_TRUE(cache.evictCache(50u));
+    EXPECT_EQ(1u, cache.getCacheEntriesCalled);
+}
+
+TEST(CompilerCacheTests, GivenCacheOverLimitWhenEvictingThenLeastRecentlyAccessedEntriesAreRemovedFirst) {
+    CompilerCacheConfig config;
+    config.cacheSize = 100u;
+    CompilerCacheEvictionMock cache(config);
+    cache.entries = {{"newest", 30u, 30u}, {"oldest", 30u, 10u}, {"middle", 30u, 20u}};
+
+    EXPECT_TRUE(cache.evictCache(20u));
+    ASSERT_EQ(2u, cache.removedEntries.size());
+    EXPECT_STREQ("oldest", cache.removedEntries[0].c_str());
+    EXPECT_STREQ("middle", cache.removedEntries[1].c_str());
+    EXPECT_EQ(30u, cache.knownCacheSize.load());
+}
+
+TEST(CompilerCacheTests, GivenTempFilesWhenEvictingThenTheyAreCountedAndOnlyStaleOnesAreRemoved) {
+    CompilerCacheConfig config;
+    config.cacheSize = 100u;
+    CompilerCacheEvictionMock cache(config);
+    cache.entries = {{"entry", 30u, 30u}, {"in_flight.tmp", 40u, 1u, true, false}, {"stale.tmp", 50u, 2u, true, true}};
+
+    EXPECT_TRUE(cache.evictCache(20u));
+    ASSERT_EQ(1u, cache.removedEntries.size());
+    EXPECT_STREQ("stale.tmp", cache.removedEntries[0].c_str());
+    EXPECT_EQ(70u, cache.knownCacheSize.load());
+
+    cache.entries = {{"entry", 30u, 30u}, {"in_flight.tmp", 60u, 1u, true, false}};
+    cache.cacheSizeKnown = false;
+    cache.removedEntries.clear();
+    EXPECT_TRUE(cache.evictCache(20u));
+    ASSERT_EQ(1u, cache.removedEntries.size());
+    EXPECT_STREQ("entry", cache.removedEntries[0].c_str());
+    EXPECT_EQ(60u, cache.knownCacheSize.load());
+}
+
+TEST(CompilerCacheTests, GivenExistingEntryWhenReplacingItThenKnownCacheSizeIncludesOnlyNewEntry) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.cacheSize = 1024u;
+    CompilerCacheEvictionMock cache(config);
+
+    const char binary[] = "some binary data";
+    const char biggerBinary[] = "some bigger binary data";
+    EXPECT_TRUE(cache.cacheBinary("cache_replaced_size", binary, static_cast<uint32_t>(sizeof(binary))));
+    EXPECT_EQ(sizeof(CompilerCacheEntryHeader) + sizeof(binary), cache.knownCacheSize.load());
+
+    EXPECT_TRUE(cache.cacheBinary("cache_replaced_size", biggerBinary, static_cast<uint32_t>(sizeof(biggerBinary))));
+    EXPECT_EQ(sizeof(CompilerCacheEntryHeader) + sizeof(biggerBinary), cache.knownCacheSize.load());
+
+    std::remove("./cache_replaced_size.neo_test_cache");
+}
+
+TEST(CompilerCacheTests, GivenRenameFailureWhenCachingThenTempFileIsRemovedAndFalseIsReturned) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.cacheSize = 1024u;
+    CompilerCacheEvictionMock cache(config);
+    cache.renameResult = false;
+
+    const char binary[] = "some binary data";
+    EXPECT_FALSE(cache.cacheBinary("cache_rename_fail", binary, static_cast<uint32_t>(sizeof(binary))));
+    EXPECT_EQ(1u, cache.renameCalled);
+    ASSERT_EQ(1u, cache.removedEntries.size());
+    EXPECT_NE(std::string::npos, cache.removedEntries[0].find("cache_rename_fail.neo_test_cache.tmp."));
+    std::remove(cache.removedEntries[0].c_str());
+    EXPECT_FALSE(fileExists("./cache_rename_fail.neo_test_cache"));
+}
+
+TEST(CompilerCacheTests, GivenMultipleThreadsWhenStoringAndLoadingEntriesConcurrentlyThenEveryLoadReturnsCompleteBinary) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    CompilerCache cache(config);
+
+    constexpr uint32_t threadCount = 8u;
+    constexpr uint32_t iterations = 16u;
+    constexpr uint32_t binarySize = 4096u;
+    std::atomic<uint32_t> failures{0u};
+
+    auto worker = [&](uint32_t threadId) {
+        std::vector<char> binary(binarySize);
+        for (uint32_t i = 0; i < iterations; i++) {
+            // half of the threads share entries to exercise concurrent stores of the same hash
+            auto entryId = (threadId % 2 == 0) ? i : threadId * iterations + i;
+            auto hash = "cache_mt_" + std::to_string(entryId);
+            std::fill(binary.begin(), binary.end(), static_cast<char>(entryId));
+            cache.cacheBinary(hash, binary.data(), binarySize);
+
+            size_t size = 0u;
+            auto loaded = cache.loadCachedBinary(hash, size);
+            if (loaded == nullptr || size != binarySize || memcmp(loaded.get(), binary.data(), binarySize) != 0) {
+                failures++;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < threadCount; threadId++) {
+        threads.emplace_back(worker, threadId);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0u, failures.load());
+
+    for (uint32_t entryId = 0; entryId < threadCount * iterations; entryId++) {
+        std::remove(("./cache_mt_" + std::to_string(entryId) + ".neo_test_cache").c_str());
+    }
+}
+
+TEST(CompilerCacheMemoryTierTests, GivenEntriesExceedingSizeWhenStoringThenLeastRecentlyUsedEntriesAreEvicted) {
+    CompilerCacheMemoryTier memoryTier(100u);
+    auto makeBinary = [](size_t size) { return CompilerCacheMemoryTier::BinaryT(new char[size]); };
+
+    memoryTier.store("a", makeBinary(40u), 40u);
+    memoryTier.store("b", makeBinary(40u), 40u);
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, memoryTier.load("a", size));
+    EXPECT_EQ(40u, size);
+
+    memoryTier.store("c", makeBinary(40u), 40u);
+    EXPECT_NE(nullptr, memoryTier.load("a", size));
+    EXPECT_EQ(nullptr, memoryTier.load("b", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_NE(nullptr, memoryTier.load("c", size));
+
+    memoryTier.store("too_big", makeBinary(101u), 101u);
+    EXPECT_EQ(nullptr, memoryTier.load("too_big", size));
+
+    auto statistics = memoryTier.getStatistics();
+    EXPECT_EQ(3u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+    EXPECT_EQ(120u, statistics.bytesServed);
+    EXPECT_EQ(120u, statistics.bytesStored);
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(80u, statistics.currentSize);
+}
+
+TEST(CompilerCacheMemoryTierTests, GivenExistingEntryWhenStoringSameHashThenEntryIsReplaced) {
+    CompilerCacheMemoryTier memoryTier(100u);
+    memoryTier.store("a", CompilerCacheMemoryTier::BinaryT(new char[40u]), 40u);
+    CompilerCacheMemoryTier::BinaryT replacement(new char[20u]);
+    memoryTier.store("a", replacement, 20u);
+
+    size_t size = 0u;
+    EXPECT_EQ(replacement, memoryTier.load("a", size));
+    EXPECT_EQ(20u, size);
+    EXPECT_EQ(20u, memoryTier.getStatistics().currentSize);
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierWhenLoadingCachedBinaryThenDiskIsReadOnceAndSharedBufferIsReused) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.memoryTierSize = 1024u;
+
+    const char binary[] = "some binary data";
+    {
+        CompilerCache diskOnlyCache(CompilerCacheConfig{false, config.cacheFileExtension, config.cacheDir});
+        EXPECT_EQ(nullptr, diskOnlyCache.getMemoryTier());
+        EXPECT_TRUE(diskOnlyCache.cacheBinary("cache_memory_tier", binary, static_cast<uint32_t>(sizeof(binary))));
+    }
+
+    CompilerCache cache(config);
+    ASSERT_NE(nullptr, cache.getMemoryTier());
+
+    size_t size = 0u;
+    auto first = cache.loadCachedBinary("cache_memory_tier", size);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, first.get(), sizeof(binary)));
+    EXPECT_EQ(0u, cache.getMemoryTier()->getStatistics().hits);
+
+    std::remove("./cache_memory_tier.neo_test_cache");
+
+    auto second = cache.loadCachedBinary("cache_memory_tier", size);
+    EXPECT_EQ(first, second);
+
+    auto statistics = cache.getMemoryTier()->getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(sizeof(binary), statistics.bytesServed);
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierWhenDiskStoreFailsThenBinaryIsStillServedFromMemory) {
+    CompilerCacheConfig config;
+    config.cacheDir = "./----do-not-exists----";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.memoryTierSize = 1024u;
+    CompilerCache cache(config);
+
+    const char binary[] = "some binary data";
+    EXPECT_TRUE(cache.cacheBinary("cache_memory_only", binary, static_cast<uint32_t>(sizeof(binary))));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("cache_memory_only", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), sizeof(binary)));
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierAndBinaryBiggerThanCacheSizeWhenCachingThenTrueIsReturnedAndBinaryIsServedFromMemory) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.cacheSize = sizeof(CompilerCacheEntryHeader) + 4;
+    config.memoryTierSize = 1024u;
+    CompilerCacheEvictionMock cache(config);
+
+    const char binary[] = "some binary data";
+    EXPECT_TRUE(cache.cacheBinary("cache_too_big", binary, static_cast<uint32_t>(sizeof(binary))));
+    EXPECT_EQ(0u, cache.renameCalled);
+    EXPECT_FALSE(fileExists("./cache_too_big.neo_test_cache"));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("cache_too_big", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierAndRenameFailureWhenCachingThenTrueIsReturnedAndBinaryIsServedFromMemory) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_test_cache";
+    config.cacheSize = 1024u;
+    config.memoryTierSize = 1024u;
+    CompilerCacheEvictionMock cache(config);
+    cache.renameResult = false;
+
+    const char binary[] = "some binary data";
+    EXPECT_TRUE(cache.cacheBinary("cache_rename_fail", binary, static_cast<uint32_t>(sizeof(binary))));
+    EXPECT_EQ(1u, cache.renameCalled);
+    ASSERT_EQ(1u, cache.removedEntries.size());
+    std::remove(cache.removedEntries[0].c_str());
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("cache_rename_fail", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+}
+
+TEST(CompilerCacheTests, GivenBinaryCacheMemoryTierSizeDebugFlagWhenCreatingCacheThenFlagOverridesConfig) {
+    DebugManagerStateRestore restorer;
+    CompilerCacheConfig config;
+    config.memoryTierSize = 1024u;
+
+    DebugManager.flags.BinaryCacheMemoryTierSize.set(0);
+    EXPECT_EQ(nullptr, CompilerCache(config).getMemoryTier());
+
+    DebugManager.flags.BinaryCacheMemoryTierSize.set(4096);
+    CompilerCache cache(config);
+    ASSERT_NE(nullptr, cache.getMemoryTier());
+    EXPECT_EQ(4096u, cache.getMemoryTier()->getMaxSize());
+}
+
+TEST(CompilerCacheTests, GivenPrintBinaryCacheStatisticsDebugFlagWhenDestroyingCacheThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintBinaryCacheStatistics.set(true);
+    CompilerCacheConfig config;
+    config.memoryTierSize = 1024u;
+
+    testing::internal::CaptureStdout();
+    {
+        CompilerCache cache(config);
+        size_t size = 0u;
+        cache.loadCachedBinary("----do-not-exists----", size);
+    }
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("Compiler cache memory tier: hits: 0, misses: 1, bytes served: 0, bytes stored: 0, evictions: 0, current size: 0 / 1024\n", output.c_str());
+}
@@ -25,6 +25,7 @@
 #include "RelocationInfo.h"
 #include "gtest/gtest.h"
 
+#include <array>
 #include <string>
 
 TEST(SegmentTypeTests, givenSegmentTypeWhenAsStringIsCalledThenProperRepresentationIsReturned) {
@@ -2520,6 +2521,54 @@ TEST(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstructionSe
     EXPECT_EQ(kd.kernelAttributes.crossThreadDataSize, static_cast<uint32_t>(*perThreadPayloadOffsetPatchedValue));
 }
 
+TEST(LinkerTests, givenMultipleWorkersWhenPatchingManyInstructionSegmentsThenAllSegmentsArePatchedAndUnresolvedExternalsAreReportedInSegmentOrder) {
+    constexpr uint32_t numSegments = 16u;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    linkerInput.traits.requiresPatchingOfInstructionSegments = true;
+    linkerInput.textRelocations.resize(numSegments);
+
+    NEO::LinkerInput::RelocationInfo perThreadPayloadOffsetRel;
+    perThreadPayloadOffsetRel.offset = 0x0;
+    perThreadPayloadOffsetRel.type = NEO::LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset;
+    perThreadPayloadOffsetRel.relocationSegment = NEO::SegmentType::Instructions;
+
+    NEO::LinkerInput::RelocationInfo unresolvedRel;
+    unresolvedRel.offset = 0x8;
+    unresolvedRel.type = NEO::LinkerInput::RelocationInfo::Type::Address;
+    unresolvedRel.relocationSegment = NEO::SegmentType::Instructions;
+    unresolvedRel.symbolName = "unresolved";
+
+    std::vector<KernelDescriptor> kds(numSegments);
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    std::vector<std::array<uint64_t, 2>> segmentsData(numSegments);
+    NEO::Linker::PatchableSegments segmentsToPatch(numSegments);
+    for (uint32_t segId = 0u; segId < numSegments; segId++) {
+        linkerInput.textRelocations[segId].push_back(perThreadPayloadOffsetRel);
+        if (segId % 2 == 1) {
+            linkerInput.textRelocations[segId].push_back(unresolvedRel);
+        }
+        kds[segId].kernelAttributes.crossThreadDataSize = 0x20 + segId * 8;
+        kernelDescriptors.push_back(&kds[segId]);
+        segmentsData[segId] = {};
+        segmentsToPatch[segId].hostPointer = segmentsData[segId].data();
+        segmentsToPatch[segId].segmentSize = sizeof(segmentsData[segId]);
+    }
+
+    WhiteBox<NEO::Linker> linker(linkerInput, 4u);
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    linker.patchInstructionsSegments(segmentsToPatch, unresolvedExternals, kernelDescriptors);
+
+    for (uint32_t segId = 0u; segId < numSegments; segId++) {
+        EXPECT_EQ(kds[segId].kernelAttributes.crossThreadDataSize, *reinterpret_cast<uint32_t *>(segmentsData[segId].data()));
+    }
+    ASSERT_EQ(numSegments / 2, unresolvedExternals.size());
+    for (uint32_t i = 0u; i < unresolvedExternals.size(); i++) {
+        EXPECT_EQ(2 * i + 1, unresolvedExternals[i].instructionsSegmentId);
+        EXPECT_EQ(unresolvedRel.symbolName, unresolvedExternals[i].unresolvedRelocation.symbolName);
+        EXPECT_FALSE(unresolvedExternals[i].internalError);
+    }
+}
+
 TEST(LinkerTests, givenRelocationToInstructionSegmentWithLocalSymbolPointingToSameSegmentThenItIsPatched) {
     std::string kernelName{"test_kernel"};
     WhiteBox<NEO::LinkerInput> linkerInput;
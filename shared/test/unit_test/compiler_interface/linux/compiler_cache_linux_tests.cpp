@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <sys/time.h>
+#include <time.h>
+#include <vector>
+
+using namespace NEO;
+
+class CompilerCacheLinuxMock : public CompilerCache {
+  public:
+    using CompilerCache::getCacheEntries;
+    using CompilerCache::mapCacheEntry;
+    using CompilerCache::verifiedEntries;
+
+    CompilerCacheLinuxMock(const CompilerCacheConfig &config) : CompilerCache(config) {}
+};
+
+struct CompilerCacheLinuxMmapTests : public ::testing::Test {
+    void SetUp() override {
+        config.cacheDir = ".";
+        config.cacheFileExtension = ".neo_test_cache";
+        config.mmapThreshold = 1u;
+        binary.resize(8192u);
+        for (size_t i = 0; i < binary.size(); i++) {
+            binary[i] = static_cast<char>(i);
+        }
+    }
+
+    void TearDown() override {
+        std::remove("./cache_mmap.neo_test_cache");
+    }
+
+    CompilerCacheConfig config;
+    std::vector<char> binary;
+};
+
+TEST_F(CompilerCacheLinuxMmapTests, GivenEntryAboveMmapThresholdWhenLoadingSharedBinaryThenEntryIsMappedWithoutCopy) {
+    CompilerCacheLinuxMock cache(config);
+    EXPECT_TRUE(cache.cacheBinary("cache_mmap", binary.data(), static_cast<uint32_t>(binary.size())));
+
+    size_t size = 0u;
+    bool isCorrupted = true;
+    auto mapped = cache.mapCacheEntry("./cache_mmap.neo_test_cache", config.mmapThreshold, size, isCorrupted);
+    ASSERT_NE(nullptr, mapped);
+    EXPECT_FALSE(isCorrupted);
+    EXPECT_EQ(binary.size(), size);
+    EXPECT_EQ(0, memcmp(binary.data(), mapped.get(), size));
+
+    auto loaded = cache.loadCachedBinary("cache_mmap", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(binary.size(), size);
+    EXPECT_EQ(0, memcmp(binary.data(), loaded.get(), size));
+
+    // the mapping keeps the content even when the entry is removed
+    std::remove("./cache_mmap.neo_test_cache");
+    EXPECT_EQ(0, memcmp(binary.data(), loaded.get(), size));
+}
+
+TEST_F(CompilerCacheLinuxMmapTests, GivenEntryBelowMmapThresholdWhenMappingThenNullIsReturnedAndEntryIsNotCorrupted) {
+    CompilerCacheLinuxMock cache(config);
+    EXPECT_TRUE(cache.cacheBinary("cache_mmap", binary.data(), static_cast<uint32_t>(binary.size())));
+
+    size_t size = 0u;
+    bool isCorrupted = true;
+    auto mapped = cache.mapCacheEntry("./cache_mmap.neo_test_cache", binary.size() * 2, size, isCorrupted);
+    EXPECT_EQ(nullptr, mapped);
+    EXPECT_FALSE(isCorrupted);
+    EXPECT_EQ(0u, size);
+
+    config.mmapThreshold = binary.size() * 2;
+    CompilerCacheLinuxMock readingCache(config);
+    auto loaded = readingCache.loadCachedBinary("cache_mmap", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(binary.size(), size);
+}
+
+TEST_F(CompilerCacheLinuxMmapTests, GivenEntryWithInvalidHeaderWhenLoadingSharedBinaryThenNullIsReturnedAndEntryIsRemoved) {
+    writeDataToFile("./cache_mmap.neo_test_cache", binary.data(), binary.size());
+
+    CompilerCacheLinuxMock cache(config);
+    size_t size = 0u;
+    bool isCorrupted = false;
+    EXPECT_EQ(nullptr, cache.mapCacheEntry("./cache_mmap.neo_test_cache", config.mmapThreshold, size, isCorrupted));
+    EXPECT_TRUE(isCorrupted);
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("cache_mmap", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_FALSE(fileExists("./cache_mmap.neo_test_cache"));
+}
+
+TEST_F(CompilerCacheLinuxMmapTests, GivenEntryWithModifiedBinaryWhenLoadingSharedBinaryThenNullIsReturnedAndEntryIsRemoved) {
+    config.memoryTierSize = binary.size() * 4;
+    CompilerCacheLinuxMock writingCache(config);
+    EXPECT_TRUE(writingCache.cacheBinary("cache_mmap", binary.data(), static_cast<uint32_t>(binary.size())));
+
+    size_t fileSize = 0u;
+    auto fileData = loadDataFromFile("./cache_mmap.neo_test_cache", fileSize);
+    ASSERT_NE(nullptr, fileData);
+    fileData[fileSize / 2] ^= 0xff;
+    writeDataToFile("./cache_mmap.neo_test_cache", fileData.get(), fileSize);
+
+    CompilerCacheLinuxMock cache(config);
+    size_t size = 0u;
+    bool isCorrupted = false;
+    EXPECT_EQ(nullptr, cache.mapCacheEntry("./cache_mmap.neo_test_cache", config.mmapThreshold, size, isCorrupted));
+    EXPECT_TRUE(isCorrupted);
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("cache_mmap", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_FALSE(fileExists("./cache_mmap.neo_test_cache"));
+}
+
+TEST_F(CompilerCacheLinuxMmapTests, GivenEntryMappedBeforeWhenMappingAgainThenChecksumIsVerifiedOnlyOnceUntilEntryIsReplaced) {
+    CompilerCacheLinuxMock cache(config);
+    EXPECT_TRUE(cache.cacheBinary("cache_mmap", binary.data(), static_cast<uint32_t>(binary.size())));
+
+    size_t size = 0u;
+    bool isCorrupted = true;
+    EXPECT_NE(nullptr, cache.mapCacheEntry("./cache_mmap.neo_test_cache", config.mmapThreshold, size, isCorrupted));
+    EXPECT_EQ(1u, cache.verifiedEntries.size());
+    EXPECT_NE(nullptr, cache.mapCacheEntry("./cache_mmap.neo_test_cache", config.mmapThreshold, size, isCorrupted));
+    EXPECT_FALSE(isCorrupted);
+    EXPECT_EQ(1u, cache.verifiedEntries.size());
+
+    // replaced entry is a new file and gets verified again
+    binary[0] ^= 0xff;
+    EXPECT_TRUE(cache.cacheBinary("cache_mmap", binary.data(), static_cast<uint32_t>(binary.size())));
+    auto mapped = cache.mapCacheEntry("./cache_mmap.neo_test_cache", config.mmapThreshold, size, isCorrupted);
+    ASSERT_NE(nullptr, mapped);
+    EXPECT_EQ(2u, cache.verifiedEntries.size());
+    EXPECT_EQ(0, memcmp(binary.data(), mapped.get(), size));
+}
+
+TEST_F(CompilerCacheLinuxMmapTests, GivenBinaryCacheMmapThresholdDebugFlagSetToZeroWhenLoadingThenEntryIsRead) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheMmapThreshold.set(0);
+
+    struct ReadOnlyCache : public CompilerCacheLinuxMock {
+        using CompilerCacheLinuxMock::CompilerCacheLinuxMock;
+        CompilerCacheMemoryTier::BinaryT mapCacheEntry(const std::string &filePath, size_t minFileSize, size_t &binarySize, bool &isCorrupted) override {
+            mapCalled++;
+            return CompilerCacheLinuxMock::mapCacheEntry(filePath, minFileSize, binarySize, isCorrupted);
+        }
+        uint32_t mapCalled = 0u;
+    } cache(config);
+
+    EXPECT_TRUE(cache.cacheBinary("cache_mmap", binary.data(), static_cast<uint32_t>(binary.size())));
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("cache_mmap", size));
+    EXPECT_EQ(binary.size(), size);
+    EXPECT_EQ(0u, cache.mapCalled);
+}
+
+TEST(CompilerCacheLinuxTests, GivenTempFilesWhenListingCacheEntriesThenTheyAreReportedAsTempFilesAndOldOnesAsStale) {
+    CompilerCacheConfig config;
+    config.cacheDir = ".";
+    config.cacheFileExtension = ".neo_list_test_cache";
+    CompilerCacheLinuxMock cache(config);
+
+    const char data[] = "some binary data";
+    writeDataToFile("./cache_list.neo_list_test_cache", data, sizeof(data));
+    writeDataToFile("./cache_list.neo_list_test_cache.tmp.1.2", data, sizeof(data));
+    writeDataToFile("./cache_list.neo_list_test_cache.tmp.3.4", data, sizeof(data));
+    struct timeval oldTime[2] = {};
+    oldTime[0].tv_sec = oldTime[1].tv_sec = time(nullptr) - static_cast<time_t>(CompilerCache::staleTempFileAgeInSeconds) - 60;
+    utimes("./cache_list.neo_list_test_cache.tmp.3.4", oldTime);
+
+    auto entries = cache.getCacheEntries();
+    ASSERT_EQ(3u, entries.size());
+    std::sort(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) { return lhs.path < rhs.path; });
+    EXPECT_STREQ("./cache_list.neo_list_test_cache", entries[0].path.c_str());
+    EXPECT_EQ(sizeof(data), entries[0].size);
+    EXPECT_FALSE(entries[0].isTempFile);
+    EXPECT_FALSE(entries[0].isStaleTempFile);
+    EXPECT_TRUE(entries[1].isTempFile);
+    EXPECT_FALSE(entries[1].isStaleTempFile);
+    EXPECT_EQ(sizeof(data), entries[1].size);
+    EXPECT_TRUE(entries[2].isTempFile);
+    EXPECT_TRUE(entries[2].isStaleTempFile);
+
+    std::remove("./cache_list.neo_list_test_cache");
+    std::remove("./cache_list.neo_list_test_cache.tmp.1.2");
+    std::remove("./cache_list.neo_list_test_cache.tmp.3.4");
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_text_classifier.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+
+using namespace NEO::Yaml;
+using namespace NEO;
+
+namespace {
+
+std::string generateZeInfo(size_t numKernels) {
+    std::string zeInfo = "version : '1.11'\nkernels:\n";
+    for (size_t kernelId = 0U; kernelId < numKernels; ++kernelId) {
+        zeInfo += "  - name : kernel_" + std::to_string(kernelId) + "\n";
+        zeInfo += "    execution_env:\n";
+        zeInfo += "      grf_count: 128\n";
+        zeInfo += "      simd_size: 32\n";
+        zeInfo += "      required_work_group_size: [ 8, 1,1 ]\n";
+        zeInfo += "    payload_arguments: # explicit and implicit arguments\n";
+        for (size_t argId = 0U; argId < 8U; ++argId) {
+            zeInfo += "      - arg_type : arg_bypointer\n";
+            zeInfo += "        offset : " + std::to_string(argId * 8) + "\r\n";
+            zeInfo += "        size :\t8\n";
+            zeInfo += "        arg_index: " + std::to_string(argId) + "\n";
+            zeInfo += "        addrmode : stateless\n";
+        }
+    }
+    return zeInfo;
+}
+
+void expectSameClassification(const TextClassification &expected, const TextClassification &actual) {
+    EXPECT_EQ(expected.numLines, actual.numLines);
+    EXPECT_EQ(expected.numTokensEstimate, actual.numTokensEstimate);
+}
+
+} // namespace
+
+TEST(YamlTextClassifier, GivenEmptyTextThenReturnsEmptyClassification) {
+    auto classification = classifyTextScalar("");
+    EXPECT_EQ(0U, classification.numLines);
+    EXPECT_EQ(0U, classification.numTokensEstimate);
+
+    classification = TextClassifier::classify("");
+    EXPECT_EQ(0U, classification.numLines);
+    EXPECT_EQ(0U, classification.numTokensEstimate);
+}
+
+TEST(YamlTextClassifier, GivenTextThenCountsNewLinesDelimitersAndTokenBeginnings) {
+    ConstStringRef text = "kernels:\n  - name: [k,l]\n";
+    auto classification = classifyTextScalar(text);
+    EXPECT_EQ(2U, classification.numLines);
+    // kernels : \n - name : [ k , l ] \n
+    EXPECT_EQ(12U, classification.numTokensEstimate);
+}
+
+TEST(YamlTextClassifier, GivenTextOfAnyLengthAndAlignmentThenDispatchedClassifierMatchesScalar) {
+    auto zeInfo = generateZeInfo(1);
+    for (size_t offset = 0U; offset < 64U; ++offset) {
+        for (size_t length = 0U; length < 160U; ++length) {
+            ConstStringRef text(zeInfo.c_str() + offset, length);
+            expectSameClassification(classifyTextScalar(text), TextClassifier::classify(text));
+        }
+    }
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+TEST(YamlTextClassifier, GivenTextOfAnyLengthAndAlignmentThenSse4ClassifierMatchesScalar) {
+    auto zeInfo = generateZeInfo(1);
+    for (size_t offset = 0U; offset < 64U; ++offset) {
+        for (size_t length = 0U; length < 160U; ++length) {
+            ConstStringRef text(zeInfo.c_str() + offset, length);
+            expectSameClassification(classifyTextScalar(text), classifyTextSimd<TextClassifierSse4>(text));
+        }
+    }
+}
+#endif
+
+TEST(YamlTextClassifier, GivenLargeZeInfoThenDispatchedClassifierMatchesScalar) {
+    auto zeInfo = generateZeInfo(256);
+    expectSameClassification(classifyTextScalar(zeInfo), TextClassifier::classify(zeInfo));
+}
+
+TEST(YamlTokenize, GivenLargeZeInfoThenCachesAreNotGrownBeyondPreSizedCapacity) {
+    auto zeInfo = generateZeInfo(256);
+    auto classification = TextClassifier::classify(zeInfo);
+
+    LinesCache lines;
+    TokensCache tokens;
+    lines.reserve(classification.numLines + 1);
+    tokens.reserve(classification.numTokensEstimate + 1);
+    auto linesCapacity = lines.capacity();
+    auto tokensCapacity = tokens.capacity();
+
+    std::string errors;
+    std::string warnings;
+    bool success = NEO::Yaml::tokenize(zeInfo, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    EXPECT_LE(lines.size(), classification.numLines + 1);
+    EXPECT_LE(tokens.size(), classification.numTokensEstimate + 1);
+    EXPECT_EQ(linesCapacity, lines.capacity());
+    EXPECT_EQ(tokensCapacity, tokens.capacity());
+}
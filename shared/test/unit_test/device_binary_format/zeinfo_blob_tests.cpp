@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/device_binary_format/elf/zebin_elf.h"
+#include "shared/source/device_binary_format/zebin_decoder.h"
+#include "shared/source/device_binary_format/zeinfo_blob.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_modules_zebin.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <vector>
+
+using namespace NEO;
+
+struct ZeInfoBlobFixture {
+    void setUp() {
+        zebin.removeSection(Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, Elf::SectionsNamesZebin::zeInfo);
+        zebin.appendSection(Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size()));
+        zebin.appendSection(Elf::SHT_PROGBITS, Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", kernelIsa);
+        zebin.appendSection(Elf::SHT_PROGBITS, Elf::SectionsNamesZebin::textPrefix.str() + "some_other_kernel", kernelIsa);
+
+        targetDevice.grfSize = 32U;
+        targetDevice.minScratchSpaceSize = 1024U;
+    }
+
+    void tearDown() {
+    }
+
+    DecodeError decode(ProgramInfo &programInfo, ArrayRef<const uint8_t> binary, ArrayRef<const uint8_t> zeInfoBlob = {}) {
+        programInfo.grfSize = targetDevice.grfSize;
+        programInfo.minScratchSpaceSize = targetDevice.minScratchSpaceSize;
+        programInfo.zeInfoBlob = zeInfoBlob;
+        decodeErrors.clear();
+        decodeWarnings.clear();
+        auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(binary, decodeErrors, decodeWarnings);
+        return decodeZebin(programInfo, elf, decodeErrors, decodeWarnings);
+    }
+
+    ArrayRef<const uint8_t> getZeInfo() {
+        return ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size());
+    }
+
+    std::string zeInfo = std::string("version :\'") + versionToString(zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : some_kernel
+      execution_env :
+        simd_size : 8
+      payload_arguments:
+        - arg_type : arg_bypointer
+          offset : 0
+          size : 8
+          arg_index : 0
+          addrmode : stateless
+          addrspace : global
+          access_type : readwrite
+        - arg_type : arg_byvalue
+          offset : 8
+          size : 4
+          arg_index : 1
+    - name : some_other_kernel
+      execution_env :
+        simd_size : 32
+)===";
+    const uint8_t kernelIsa[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    ZebinTestData::ValidEmptyProgram<> zebin;
+    TargetDevice targetDevice;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+};
+
+using ZeInfoBlobTest = Test<ZeInfoBlobFixture>;
+
+TEST_F(ZeInfoBlobTest, GivenZebinWhenCreatingZeInfoBlobThenProgramDecodedWithBlobMatchesProgramDecodedFromZeInfo) {
+    ProgramInfo programFromZeInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage));
+
+    auto blob = createZeInfoBlob(zebin.storage, targetDevice);
+    ASSERT_FALSE(blob.empty());
+
+    ProgramInfo programFromBlob;
+    ASSERT_EQ(DecodeError::Success, decode(programFromBlob, zebin.storage, blob));
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+
+    ASSERT_EQ(programFromZeInfo.kernelInfos.size(), programFromBlob.kernelInfos.size());
+    for (size_t i = 0; i < programFromZeInfo.kernelInfos.size(); ++i) {
+        const auto &expected = *programFromZeInfo.kernelInfos[i];
+        const auto &actual = *programFromBlob.kernelInfos[i];
+        EXPECT_EQ(expected.kernelDescriptor.kernelMetadata.kernelName, actual.kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(expected.kernelDescriptor.kernelAttributes.simdSize, actual.kernelDescriptor.kernelAttributes.simdSize);
+        EXPECT_EQ(expected.kernelDescriptor.kernelAttributes.crossThreadDataSize, actual.kernelDescriptor.kernelAttributes.crossThreadDataSize);
+        EXPECT_EQ(expected.kernelDescriptor.kernelAttributes.binaryFormat, actual.kernelDescriptor.kernelAttributes.binaryFormat);
+        ASSERT_EQ(expected.kernelDescriptor.payloadMappings.explicitArgs.size(), actual.kernelDescriptor.payloadMappings.explicitArgs.size());
+        for (size_t argNum = 0; argNum < expected.kernelDescriptor.payloadMappings.explicitArgs.size(); ++argNum) {
+            EXPECT_EQ(expected.kernelDescriptor.payloadMappings.explicitArgs[argNum].type, actual.kernelDescriptor.payloadMappings.explicitArgs[argNum].type);
+        }
+        EXPECT_EQ(expected.kernelDescriptor.kernelMetadata.allByValueKernelArguments.size(), actual.kernelDescriptor.kernelMetadata.allByValueKernelArguments.size());
+        EXPECT_EQ(expected.heapInfo.KernelHeapSize, actual.heapInfo.KernelHeapSize);
+        ASSERT_NE(nullptr, actual.heapInfo.pKernelHeap);
+        EXPECT_EQ(0, memcmp(kernelIsa, actual.heapInfo.pKernelHeap, sizeof(kernelIsa)));
+    }
+
+    const auto &byPointerArg = programFromBlob.kernelInfos[0]->kernelDescriptor.payloadMappings.explicitArgs[0];
+    ASSERT_TRUE(byPointerArg.is<ArgDescriptor::ArgTPointer>());
+    EXPECT_EQ(0U, byPointerArg.as<ArgDescPointer>().stateless);
+    EXPECT_EQ(8U, byPointerArg.as<ArgDescPointer>().pointerSize);
+    EXPECT_EQ(KernelArgMetadata::AddrGlobal, byPointerArg.getTraits().addressQualifier);
+
+    const auto &byValueArg = programFromBlob.kernelInfos[0]->kernelDescriptor.payloadMappings.explicitArgs[1];
+    ASSERT_TRUE(byValueArg.is<ArgDescriptor::ArgTValue>());
+    ASSERT_EQ(1U, byValueArg.as<ArgDescValue>().elements.size());
+    EXPECT_EQ(8U, byValueArg.as<ArgDescValue>().elements[0].offset);
+    EXPECT_EQ(4U, byValueArg.as<ArgDescValue>().elements[0].size);
+}
+
+TEST_F(ZeInfoBlobTest, GivenZeInfoBlobWhenDecodingZebinThenKernelDescriptorIsTakenFromBlob) {
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+    auto blob = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "");
+
+    ProgramInfo programFromBlob;
+    ASSERT_EQ(DecodeError::Success, decode(programFromBlob, zebin.storage, blob));
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+    ASSERT_EQ(2U, programFromBlob.kernelInfos.size());
+    EXPECT_EQ(16U, programFromBlob.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+}
+
+TEST_F(ZeInfoBlobTest, GivenDisableZebinZeInfoBlobWhenDecodingZebinWithZeInfoBlobThenZeInfoIsParsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DisableZebinZeInfoBlob.set(true);
+
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+    auto blob = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "");
+
+    ProgramInfo programFromZeInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage, blob));
+    ASSERT_EQ(2U, programFromZeInfo.kernelInfos.size());
+    EXPECT_EQ(8U, programFromZeInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+}
+
+TEST_F(ZeInfoBlobTest, GivenStaleZeInfoBlobThenZeInfoIsParsed) {
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+
+    std::string otherZeInfo = zeInfo + "\n";
+    auto blobFromOtherZeInfo = serializeZeInfoBlob(programInfo, ArrayRef<const uint8_t>::fromAny(otherZeInfo.data(), otherZeInfo.size()), zeInfoDecoderVersion, "");
+    ProgramInfo programFromZeInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage, blobFromOtherZeInfo));
+    EXPECT_EQ(8U, programFromZeInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+
+    programInfo.grfSize = 64U;
+    auto blobForOtherGrfSize = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "");
+    ProgramInfo programFromZeInfo2;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo2, zebin.storage, blobForOtherGrfSize));
+    EXPECT_EQ(8U, programFromZeInfo2.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+
+    programInfo.grfSize = targetDevice.grfSize;
+    auto blobFromOtherDriverBuild = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "");
+    reinterpret_cast<ZeInfoBlobHeader *>(blobFromOtherDriverBuild.data())->driverBuildId ^= 1u;
+    ProgramInfo programFromZeInfo3;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo3, zebin.storage, blobFromOtherDriverBuild));
+    EXPECT_EQ(8U, programFromZeInfo3.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+}
+
+TEST_F(ZeInfoBlobTest, GivenTruncatedZeInfoBlobThenZeInfoIsParsed) {
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+    auto blob = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "");
+
+    for (auto truncatedSize : {size_t{0U}, sizeof(ZeInfoBlobHeader) - 1, sizeof(ZeInfoBlobHeader), blob.size() - 1}) {
+        ZeInfoBlobContent content;
+        EXPECT_FALSE(deserializeZeInfoBlob(content, ArrayRef<const uint8_t>(blob.data(), truncatedSize), getZeInfo(), programInfo));
+
+        ProgramInfo programFromZeInfo;
+        ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage, ArrayRef<const uint8_t>(blob.data(), truncatedSize)));
+        EXPECT_EQ(8U, programFromZeInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+    }
+}
+
+TEST_F(ZeInfoBlobTest, GivenZeInfoBlobWithIncompatibleZeInfoVersionThenZeInfoIsParsed) {
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+    auto incompatibleVersion = zeInfoDecoderVersion;
+    incompatibleVersion.major += 1;
+    auto blob = serializeZeInfoBlob(programInfo, getZeInfo(), incompatibleVersion, "");
+
+    ProgramInfo programFromZeInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage, blob));
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    ASSERT_EQ(2U, programFromZeInfo.kernelInfos.size());
+    EXPECT_EQ(8U, programFromZeInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+}
+
+TEST_F(ZeInfoBlobTest, GivenZeInfoBlobWithStoredWarningsThenWarningsAreReportedWhenDecodingFromBlob) {
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+    auto blob = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "stored warning\n");
+
+    ProgramInfo programFromBlob;
+    ASSERT_EQ(DecodeError::Success, decode(programFromBlob, zebin.storage, blob));
+    EXPECT_EQ(16U, programFromBlob.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+    EXPECT_STREQ("stored warning\n", decodeWarnings.c_str());
+}
+
+TEST_F(ZeInfoBlobTest, GivenZeInfoWithWarningsWhenCreatingZeInfoBlobThenSameWarningsAreReportedWhenDecodingWithBlob) {
+    zeInfo = std::string("version :\'") + versionToString({zeInfoDecoderVersion.major, zeInfoDecoderVersion.minor + 1}) + R"===('
+kernels:
+    - name : some_kernel
+      execution_env :
+        simd_size : 8
+        some_unknown_entry : 1
+    - name : some_other_kernel
+      execution_env :
+        simd_size : 32
+)===";
+    zebin.removeSection(Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, Elf::SectionsNamesZebin::zeInfo);
+    zebin.appendSection(Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, Elf::SectionsNamesZebin::zeInfo, getZeInfo());
+
+    ProgramInfo programFromZeInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage));
+    auto zeInfoWarnings = decodeWarnings;
+    EXPECT_FALSE(zeInfoWarnings.empty());
+
+    auto blob = createZeInfoBlob(zebin.storage, targetDevice);
+    ASSERT_FALSE(blob.empty());
+
+    ProgramInfo programFromBlob;
+    ASSERT_EQ(DecodeError::Success, decode(programFromBlob, zebin.storage, blob));
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_EQ(zeInfoWarnings, decodeWarnings);
+}
+
+TEST_F(ZeInfoBlobTest, GivenInputOtherThanZebinWhenCreatingZeInfoBlobThenEmptyVectorIsReturned) {
+    const uint8_t notZebin[] = {1, 2, 3, 4};
+    EXPECT_TRUE(createZeInfoBlob(notZebin, targetDevice).empty());
+}
+
+TEST_F(ZeInfoBlobTest, GivenZebinWithEmbeddedZeInfoBlobSectionWhenDecodingThenSectionIsNotTrustedAndZeInfoIsParsed) {
+    ProgramInfo programInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programInfo, zebin.storage));
+    programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize = 16U;
+    auto blob = serializeZeInfoBlob(programInfo, getZeInfo(), zeInfoDecoderVersion, "");
+    zebin.appendSection(Elf::SHT_ZEBIN::SHT_ZEBIN_MISC, ".misc.zeInfoBlob", blob);
+
+    ProgramInfo programFromZeInfo;
+    ASSERT_EQ(DecodeError::Success, decode(programFromZeInfo, zebin.storage));
+    ASSERT_EQ(2U, programFromZeInfo.kernelInfos.size());
+    EXPECT_EQ(8U, programFromZeInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+}
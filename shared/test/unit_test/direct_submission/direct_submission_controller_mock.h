@@ -11,11 +11,14 @@
 
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::activeDirectSubmissionsCount;
     using DirectSubmissionController::checkNewSubmissions;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
     using DirectSubmissionController::keepControlling;
+    using DirectSubmissionController::maxTimeout;
+    using DirectSubmissionController::stopControlling;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
 
@@ -24,6 +27,11 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
         this->sleepCalled = true;
     }
 
-    bool sleepCalled = false;
+    SteadyClock::time_point getCpuTimestamp() override {
+        return cpuTimestamp;
+    }
+
+    SteadyClock::time_point cpuTimestamp{};
+    std::atomic_bool sleepCalled = false;
 };
 } // namespace NEO
\ No newline at end of file
@@ -32,6 +32,15 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllertimeoutDivi
     EXPECT_EQ(controller.timeoutDivisor, 4);
 }
 
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerMaxTimeoutWhenCreateObjectThenMaxTimeoutIsEqualWithDebugFlag) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerMaxTimeout.set(100);
+
+    DirectSubmissionControllerMock controller;
+
+    EXPECT_EQ(controller.maxTimeout, 100);
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegisterDirectSubmissionWorksThenItIsMonitoringItsState) {
     MockExecutionEnvironment executionEnvironment;
     executionEnvironment.prepareRootDeviceEnvironments(1);
@@ -46,9 +55,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr.taskCount.store(5u);
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread->join();
-    controller.directSubmissionControllingThread.reset();
+    controller.stopControlling();
     controller.registerDirectSubmission(&csr);
 
     controller.checkNewSubmissions();
@@ -117,20 +124,15 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWithStarted
 
     while (!controller.sleepCalled) {
     }
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread->join();
-    controller.directSubmissionControllingThread.reset();
+    controller.stopControlling();
 }
 
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWithNotStartedControllingWhenShuttingDownThenNoHang) {
     DirectSubmissionControllerMock controller;
     EXPECT_NE(controller.directSubmissionControllingThread.get(), nullptr);
 
-    while (!controller.sleepCalled) {
-    }
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread->join();
-    controller.directSubmissionControllingThread.reset();
+    controller.stopControlling();
+    EXPECT_EQ(controller.directSubmissionControllingThread.get(), nullptr);
 }
 
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegisterCsrsThenTimeoutIsNotAdjusted) {
@@ -170,9 +172,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr4.setupContext(*osContext4.get());
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread->join();
-    controller.directSubmissionControllingThread.reset();
+    controller.stopControlling();
 
     EXPECT_EQ(controller.timeout, 5000);
 
@@ -274,9 +274,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr10.setupContext(*osContext10.get());
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread->join();
-    controller.directSubmissionControllingThread.reset();
+    controller.stopControlling();
 
     EXPECT_EQ(controller.timeout, 5000);
 
@@ -357,9 +355,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     csr4.setupContext(*osContext4.get());
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread->join();
-    controller.directSubmissionControllingThread.reset();
+    controller.stopControlling();
 
     EXPECT_EQ(controller.timeout, 5000);
 
@@ -385,4 +381,93 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     controller.unregisterDirectSubmission(&csr4);
 }
 
-} // namespace NEO
\ No newline at end of file
+TEST(DirectSubmissionControllerTests, givenSubmissionsWithGapsShorterThanMaxTimeoutWhenCheckingSubmissionsThenRingIsKeptRunningForPredictedGap) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.registerDirectSubmission(&csr);
+    EXPECT_EQ(controller.timeout, 5000);
+    EXPECT_EQ(controller.maxTimeout, 20000);
+
+    auto startTime = controller.cpuTimestamp;
+    auto setTime = [&](int64_t microseconds) { controller.cpuTimestamp = startTime + std::chrono::microseconds(microseconds); };
+
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    csr.taskCount.store(2u);
+    setTime(10000);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(controller.directSubmissions[&csr].predictedIdleTime, 10000);
+
+    setTime(15000);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.activeDirectSubmissionsCount, 1u);
+    EXPECT_EQ(controller.getRingStopCount(), 0u);
+
+    setTime(25000);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.activeDirectSubmissionsCount, 0u);
+    EXPECT_EQ(controller.getRingStopCount(), 1u);
+
+    csr.taskCount.store(3u);
+    setTime(100000);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.getRingRestartCount(), 1u);
+    EXPECT_EQ(controller.directSubmissions[&csr].predictedIdleTime, 30000);
+
+    setTime(105000);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.getRingStopCount(), 2u);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerMaxTimeoutSetToZeroWhenNoNewSubmissionsThenRingIsStoppedAfterSingleIdlePeriod) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerMaxTimeout.set(0);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.registerDirectSubmission(&csr);
+
+    auto startTime = controller.cpuTimestamp;
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    csr.taskCount.store(2u);
+    controller.cpuTimestamp = startTime + std::chrono::microseconds(10000);
+    controller.checkNewSubmissions();
+
+    controller.cpuTimestamp = startTime + std::chrono::microseconds(10001);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.getRingStopCount(), 1u);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+} // namespace NEO
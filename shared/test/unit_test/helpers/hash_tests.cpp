@@ -9,6 +9,9 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace NEO;
 
 TEST(HashTests, givenSamePointersWhenHashIsCalculatedThenSame32BitValuesAreGenerated) {
@@ -34,3 +37,86 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(Hash128Tests, givenSameInputWhenHashIsCalculatedThenSameValueIsReturned) {
+    const char data[] = "__kernel void k(__global int *dst) { dst[get_global_id(0)] = 0; }";
+
+    auto hash1 = Hash128::hash(data, sizeof(data));
+    auto hash2 = Hash128::hash(data, sizeof(data));
+
+    EXPECT_EQ(hash1, hash2);
+}
+
+TEST(Hash128Tests, givenInputsDifferingInSingleByteWhenHashIsCalculatedThenBothHalvesDiffer) {
+    std::vector<char> data(100);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i);
+    }
+
+    for (size_t size = 1; size <= data.size(); size++) {
+        auto original = Hash128::hash(data.data(), size);
+        for (size_t pos = 0; pos < size; pos++) {
+            data[pos] ^= 0x1;
+            auto modified = Hash128::hash(data.data(), size);
+            data[pos] ^= 0x1;
+
+            EXPECT_NE(original.low, modified.low) << "size " << size << " pos " << pos;
+            EXPECT_NE(original.high, modified.high) << "size " << size << " pos " << pos;
+        }
+    }
+}
+
+TEST(Hash128Tests, givenInputsOfDifferentSizesWhenHashIsCalculatedThenValuesDiffer) {
+    std::vector<char> data(100, 0);
+    std::vector<Hash128Value> hashes;
+
+    for (size_t size = 0; size <= data.size(); size++) {
+        auto res = Hash128::hash(data.data(), size);
+        for (auto &previous : hashes) {
+            EXPECT_NE(previous, res) << "size " << size;
+        }
+        hashes.push_back(res);
+    }
+}
+
+TEST(Hash128Tests, givenInputSplitIntoChunksWhenUpdatingThenResultMatchesSingleUpdate) {
+    std::vector<char> data(200);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 7);
+    }
+    auto expected = Hash128::hash(data.data(), data.size());
+
+    for (size_t chunkSize = 1; chunkSize <= data.size(); chunkSize++) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << "chunk size " << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenMisalignedBufferWhenHashIsCalculatedThenResultMatchesAlignedBuffer) {
+    alignas(8) char aligned[72] = {};
+    alignas(8) char misaligned[73] = {};
+    for (size_t i = 0; i < sizeof(aligned); i++) {
+        aligned[i] = static_cast<char>(i + 3);
+        misaligned[i + 1] = aligned[i];
+    }
+
+    EXPECT_EQ(Hash128::hash(aligned, sizeof(aligned)), Hash128::hash(misaligned + 1, sizeof(aligned)));
+}
+
+TEST(Hash128Tests, givenUsedHashWhenResetIsCalledThenInitialStateIsRestored) {
+    const char data[] = "0123456789abcdef0123456789abcdef0123";
+    Hash128 hash;
+    auto initial = hash.finish();
+
+    hash.update(data, sizeof(data));
+    EXPECT_NE(initial, hash.finish());
+
+    hash.reset();
+    EXPECT_EQ(initial, hash.finish());
+
+    hash.update(nullptr, 10);
+    EXPECT_EQ(initial, hash.finish());
+}
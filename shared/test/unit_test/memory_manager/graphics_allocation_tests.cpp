@@ -412,6 +412,79 @@ HWTEST_F(GraphicsAllocationTests, givenMultiStorageGraphicsAllocationWhenTbxWrit
     EXPECT_TRUE(graphicsAllocation.isTbxWritable(0b1010));
 }
 
+TEST(GraphicsAllocationTest, givenFullyAubWritableAllocationWhenWritableRangeIsSetThenWholeAllocationStaysWritable) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 4 * MemoryConstants::pageSize);
+
+    graphicsAllocation.setAubWritableRange(MemoryConstants::pageSize, 16, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setTbxWritableRange(MemoryConstants::pageSize, 16, GraphicsAllocation::defaultBank);
+
+    EXPECT_TRUE(graphicsAllocation.isAubWritable(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(graphicsAllocation.isTbxWritable(GraphicsAllocation::defaultBank));
+    EXPECT_EQ(nullptr, graphicsAllocation.getAubWritableRanges(GraphicsAllocation::defaultBank));
+    EXPECT_EQ(nullptr, graphicsAllocation.getTbxWritableRanges(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(graphicsAllocation.aubInfo.aubWritableRanges.empty());
+    EXPECT_TRUE(graphicsAllocation.aubInfo.tbxWritableRanges.empty());
+}
+
+TEST(GraphicsAllocationTest, givenNonAubWritableAllocationWhenWritableRangesAreSetThenPageAlignedRangesAreMerged) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 8 * MemoryConstants::pageSize);
+    graphicsAllocation.setAubWritable(false, GraphicsAllocation::defaultBank);
+
+    graphicsAllocation.setAubWritableRange(5 * MemoryConstants::pageSize + 8, 16, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritableRange(MemoryConstants::pageSize - 4, 8, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritableRange(2 * MemoryConstants::pageSize, MemoryConstants::pageSize, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritableRange(7 * MemoryConstants::pageSize, 0, GraphicsAllocation::defaultBank);
+
+    EXPECT_TRUE(graphicsAllocation.isAubWritable(GraphicsAllocation::defaultBank));
+    auto ranges = graphicsAllocation.getAubWritableRanges(GraphicsAllocation::defaultBank);
+    ASSERT_NE(nullptr, ranges);
+    ASSERT_EQ(2u, ranges->size());
+    EXPECT_EQ(0u, (*ranges)[0].first);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, (*ranges)[0].second);
+    EXPECT_EQ(5 * MemoryConstants::pageSize, (*ranges)[1].first);
+    EXPECT_EQ(MemoryConstants::pageSize, (*ranges)[1].second);
+
+    EXPECT_TRUE(graphicsAllocation.isTbxWritable(GraphicsAllocation::defaultBank));
+    EXPECT_EQ(nullptr, graphicsAllocation.getTbxWritableRanges(GraphicsAllocation::defaultBank));
+}
+
+TEST(GraphicsAllocationTest, givenAllocationWithAubWritableRangesWhenAubWritableIsSetThenRangesAreDropped) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 4 * MemoryConstants::pageSize);
+
+    graphicsAllocation.setAubWritable(false, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritableRange(0, 16, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritable(true, GraphicsAllocation::defaultBank);
+    EXPECT_TRUE(graphicsAllocation.isAubWritable(GraphicsAllocation::defaultBank));
+    EXPECT_EQ(nullptr, graphicsAllocation.getAubWritableRanges(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(graphicsAllocation.aubInfo.aubWritableRanges.empty());
+
+    graphicsAllocation.setAubWritable(false, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritableRange(0, 16, GraphicsAllocation::defaultBank);
+    graphicsAllocation.setAubWritable(false, GraphicsAllocation::defaultBank);
+    EXPECT_FALSE(graphicsAllocation.isAubWritable(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(graphicsAllocation.aubInfo.aubWritableRanges.empty());
+}
+
+TEST(GraphicsAllocationTest, givenMultiBankAllocationWhenTbxWritableRangeIsSetThenOnlyNonWritableBanksAreLimitedToRanges) {
+    MockGraphicsAllocation graphicsAllocation(nullptr, 4 * MemoryConstants::pageSize);
+    graphicsAllocation.setTbxWritable(false, 0b10);
+
+    graphicsAllocation.setTbxWritableRange(MemoryConstants::pageSize, 16, GraphicsAllocation::allBanks);
+
+    EXPECT_EQ(nullptr, graphicsAllocation.getTbxWritableRanges(0b1));
+    EXPECT_EQ(nullptr, graphicsAllocation.getTbxWritableRanges(0b11));
+    auto ranges = graphicsAllocation.getTbxWritableRanges(0b10);
+    ASSERT_NE(nullptr, ranges);
+    ASSERT_EQ(1u, ranges->size());
+    EXPECT_EQ(MemoryConstants::pageSize, (*ranges)[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, (*ranges)[0].second);
+
+    graphicsAllocation.setTbxWritable(false, 0b10);
+    EXPECT_FALSE(graphicsAllocation.isTbxWritable(0b10));
+    EXPECT_TRUE(graphicsAllocation.isTbxWritable(0b1));
+    EXPECT_TRUE(graphicsAllocation.aubInfo.tbxWritableRanges.empty());
+}
+
 uint32_t MockGraphicsAllocationTaskCount::getTaskCountCalleedTimes = 0;
 
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenAssignedTaskCountEqualZeroThenPrepareForResidencyDoeNotCallGetTaskCount) {
@@ -326,3 +326,86 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingReusableAllocationThenSmallestFittingSizeClassIsUsed) {
+    auto bigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 16 * MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    *csr->getTagAddress() = 1u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 1u);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*bigAllocation));
+
+    auto reusedBigAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, AllocationType::BUFFER);
+    EXPECT_EQ(bigAllocation, reusedBigAllocation.get());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(reusedBigAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationRemovedFromListWhenObtainingReusableAllocationThenItIsNotReturned) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    *csr->getTagAddress() = 1u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 1u);
+
+    auto removedAllocation = csr->getAllocationsForReuse().removeOne(*allocation);
+    EXPECT_EQ(allocation, removedAllocation.get());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, AllocationType::BUFFER);
+    EXPECT_EQ(allocation2, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(MemoryConstants::pageSize, AllocationType::BUFFER));
+
+    storage->storeAllocationWithTaskCount(std::move(removedAllocation), REUSABLE_ALLOCATION, 1u);
+    GraphicsAllocation *detachedNodes = csr->getAllocationsForReuse().detachNodes();
+    EXPECT_EQ(allocation, detachedNodes);
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(MemoryConstants::pageSize, AllocationType::BUFFER));
+
+    csr->getAllocationsForReuse().splice(*detachedNodes);
+    EXPECT_EQ(allocation, storage->obtainReusableAllocation(MemoryConstants::pageSize, AllocationType::BUFFER).release());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenFlushTaskLikeChurnWhenReusingAllocationsThenOnlyCompletedAllocationsAreReusedAndPoolStaysBounded) {
+    const std::array<AllocationType, 3> allocationTypes = {AllocationType::COMMAND_BUFFER, AllocationType::LINEAR_STREAM, AllocationType::BUFFER};
+    const std::array<size_t, 3> allocationSizes = {MemoryConstants::pageSize, 4 * MemoryConstants::pageSize, 16 * MemoryConstants::pageSize};
+    constexpr uint32_t gpuLag = 3u;
+    constexpr uint32_t iterations = 3000u;
+
+    auto contextId = csr->getOsContext().getContextId();
+    uint32_t allocationsCreated = 0u;
+    *csr->getTagAddress() = 0u;
+
+    for (uint32_t taskCount = 1u; taskCount <= iterations; taskCount++) {
+        const auto allocationType = allocationTypes[taskCount % allocationTypes.size()];
+        const auto allocationSize = allocationSizes[(taskCount / allocationTypes.size()) % allocationSizes.size()];
+
+        auto allocation = storage->obtainReusableAllocation(allocationSize, allocationType);
+        if (allocation) {
+            ASSERT_EQ(allocationType, allocation->getAllocationType());
+            ASSERT_LE(allocationSize, allocation->getUnderlyingBufferSize());
+            ASSERT_LE(allocation->getTaskCount(contextId), *csr->getTagAddress());
+        } else {
+            allocation.reset(memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, allocationSize, allocationType, mockDeviceBitfield}));
+            allocationsCreated++;
+        }
+
+        storage->storeAllocationWithTaskCount(std::move(allocation), REUSABLE_ALLOCATION, taskCount);
+        if (taskCount > gpuLag) {
+            *csr->getTagAddress() = taskCount - gpuLag;
+        }
+    }
+
+    EXPECT_LE(allocationsCreated, allocationTypes.size() * allocationSizes.size() * (gpuLag + 1));
+
+    storage->cleanAllocationList(iterations, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+}
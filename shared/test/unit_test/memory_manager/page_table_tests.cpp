@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -553,3 +554,100 @@ TEST_F(PageTableTests32, GivenPagesOnTableBoundary2ndAllocationWhenMappingThenAd
     auto phys2 = pageTable->map(addr1, size, 0, MemoryBanks::MainBank);
     EXPECT_EQ(startAddress + pageSize, phys2);
 }
+
+struct CoalescedRange {
+    uint64_t physAddress;
+    size_t size;
+    size_t offset;
+    uint64_t entryBits;
+};
+
+TEST(CoalescingPageWalkerTests, givenPhysicallyContiguousPagesWhenAddedThenTheyAreReportedAsSingleRange) {
+    std::vector<CoalescedRange> ranges;
+    PageWalker rangeWalker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        ranges.push_back({physAddress, size, offset, entryBits});
+    };
+    CoalescingPageWalker coalescingWalker(rangeWalker, 16 * MemoryConstants::pageSize);
+
+    coalescingWalker.addPage(0x10800, 0x800, 0, 0x3);
+    coalescingWalker.addPage(0x11000, 0x1000, 0x800, 0x3);
+    coalescingWalker.addPage(0x12000, 0x100, 0x1800, 0x3);
+    EXPECT_TRUE(ranges.empty());
+
+    coalescingWalker.flush();
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(0x10800u, ranges[0].physAddress);
+    EXPECT_EQ(0x1900u, ranges[0].size);
+    EXPECT_EQ(0u, ranges[0].offset);
+    EXPECT_EQ(0x3u, ranges[0].entryBits);
+
+    coalescingWalker.flush();
+    EXPECT_EQ(1u, ranges.size());
+}
+
+TEST(CoalescingPageWalkerTests, givenPagesBreakingContiguityWhenAddedThenNewRangeIsStarted) {
+    std::vector<CoalescedRange> ranges;
+    PageWalker rangeWalker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        ranges.push_back({physAddress, size, offset, entryBits});
+    };
+    CoalescingPageWalker coalescingWalker(rangeWalker, 16 * MemoryConstants::pageSize);
+
+    coalescingWalker.addPage(0x10000, 0x1000, 0, 0x3);
+    coalescingWalker.addPage(0x20000, 0x1000, 0x1000, 0x3);
+    coalescingWalker.addPage(0x21000, 0x1000, 0x2000, 0x7);
+    coalescingWalker.addPage(0x22000, 0x1000, 0x4000, 0x7);
+    coalescingWalker.flush();
+
+    ASSERT_EQ(4u, ranges.size());
+    EXPECT_EQ(0x10000u, ranges[0].physAddress);
+    EXPECT_EQ(0x20000u, ranges[1].physAddress);
+    EXPECT_EQ(0x21000u, ranges[2].physAddress);
+    EXPECT_EQ(0x7u, ranges[2].entryBits);
+    EXPECT_EQ(0x22000u, ranges[3].physAddress);
+    EXPECT_EQ(0x4000u, ranges[3].offset);
+}
+
+TEST(CoalescingPageWalkerTests, givenRangeReachingMaxSizeWhenNextContiguousPageIsAddedThenNewRangeIsStarted) {
+    std::vector<CoalescedRange> ranges;
+    PageWalker rangeWalker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        ranges.push_back({physAddress, size, offset, entryBits});
+    };
+    CoalescingPageWalker coalescingWalker(rangeWalker, 2 * MemoryConstants::pageSize);
+
+    for (size_t page = 0; page < 5; page++) {
+        coalescingWalker.addPage(0x10000 + page * MemoryConstants::pageSize, MemoryConstants::pageSize, page * MemoryConstants::pageSize, 0x3);
+    }
+    coalescingWalker.flush();
+
+    ASSERT_EQ(3u, ranges.size());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, ranges[0].size);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, ranges[1].size);
+    EXPECT_EQ(0x12000u, ranges[1].physAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, ranges[2].size);
+    EXPECT_EQ(4 * MemoryConstants::pageSize, ranges[2].offset);
+}
+
+TEST_F(PageTableTests48, givenContiguouslyMappedRangeWhenWalkedThroughCoalescingWalkerThenSingleRangeIsReported) {
+    std::unique_ptr<std::conditional<is64bit, MockPML4, MockPDPE>::type>
+        pageTable(std::make_unique<std::conditional<is64bit, MockPML4, MockPDPE>::type>(&allocator));
+
+    uintptr_t gpuVa = 0x100000;
+    size_t size = 8 * pageSize;
+    auto physAddress = pageTable->map(gpuVa, size, 0, MemoryBanks::MainBank);
+
+    std::vector<CoalescedRange> ranges;
+    PageWalker rangeWalker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        ranges.push_back({physAddress, size, offset, entryBits});
+    };
+    CoalescingPageWalker coalescingWalker(rangeWalker, 16 * MemoryConstants::pageSize);
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        coalescingWalker.addPage(physAddress, size, offset, entryBits);
+    };
+    pageTable->pageWalk(gpuVa, size, 0, PageTableEntry::nonValidBits, walker, MemoryBanks::MainBank);
+    coalescingWalker.flush();
+
+    ASSERT_EQ(1u, ranges.size());
+    EXPECT_EQ(physAddress, ranges[0].physAddress);
+    EXPECT_EQ(size, ranges[0].size);
+    EXPECT_EQ(0u, ranges[0].offset);
+}
@@ -310,6 +310,38 @@ TEST(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCache
     ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
 }
 
+TEST(SvmDeviceAllocationCacheTest, givenDeviceAllocationsInCacheWhenSharedAllocationFailsThenCacheIsTrimmedAndAllocationSucceeds) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(0);
+    auto device = deviceFactory->rootDevices[0];
+    device->injectMemoryManager(new MockMemoryManagerWithCapacity(*device->getExecutionEnvironment()));
+    MockMemoryManagerWithCapacity *memoryManager = static_cast<MockMemoryManagerWithCapacity *>(device->getMemoryManager());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    ASSERT_FALSE(svmManager->usmHostAllocationsCacheEnabled);
+
+    memoryManager->capacity = MemoryConstants::pageSize64k * 2;
+
+    SVMAllocsManager::UnifiedMemoryProperties deviceMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    deviceMemoryProperties.device = device;
+    auto allocationInCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, deviceMemoryProperties);
+    auto allocationInCache2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, deviceMemoryProperties);
+    svmManager->freeSVMAlloc(allocationInCache);
+    svmManager->freeSVMAlloc(allocationInCache2);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 2u);
+
+    SVMAllocsManager::UnifiedMemoryProperties sharedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    sharedMemoryProperties.device = device;
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, sharedMemoryProperties, nullptr);
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    svmManager->freeSVMAlloc(ptr);
+}
+
 TEST(SvmDeviceAllocationCacheTest, givenCachedAllocationsWhenDestructorIsCalledThenCacheAllocationsAreFreed) {
     std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
     RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
@@ -346,4 +378,218 @@ TEST(SvmDeviceAllocationCacheTest, givenCachedAllocationsWhenDestructorIsCalledT
     ASSERT_EQ(memoryManager->freeGraphicsMemoryCalled, 0u);
     svmManager.reset();
     EXPECT_EQ(memoryManager->freeGraphicsMemoryCalled, testDataset.size());
-}
\ No newline at end of file
+}
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnabledThenItIsDisabled) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_EQ(DebugManager.flags.ExperimentalEnableHostAllocationCache.get(), -1);
+    EXPECT_FALSE(svmManager->usmHostAllocationsCacheEnabled);
+}
+
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAllocationThenItIsReusedForAllocationOfSameSize) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+    EXPECT_EQ(SVMAllocsManager::SvmAllocationCache::defaultMaxCachedHostBytes, svmManager->usmHostAllocationsCache.maxCachedBytesPerDevice);
+    EXPECT_EQ(SVMAllocsManager::SvmAllocationCache::defaultMaxCachedBytesPerDevice, svmManager->usmSharedAllocationsCache.maxCachedBytesPerDevice);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.missCount);
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+
+    auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, secondAllocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.hitCount);
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.cachedBytesPerDevice[nullptr]);
+
+    svmManager->freeSVMAlloc(secondAllocation);
+    svmManager->trimUSMHostAllocCaches();
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST(SvmHostAllocationCacheTest, givenCachedHostAllocationMuchLargerThanRequestedWhenAllocatingThenItIsNotReused) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 4, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+    svmManager->freeSVMAlloc(allocation);
+    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+
+    auto smallAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_NE(allocation, smallAllocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+
+    auto matchingAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, matchingAllocation);
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+
+    svmManager->freeSVMAlloc(smallAllocation);
+    svmManager->freeSVMAlloc(matchingAllocation);
+}
+
+TEST(SvmHostAllocationCacheTest, givenCacheSizeLimitWhenFreeingHostAllocationsThenAllocationsAboveLimitAreReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    DebugManager.flags.ExperimentalHostAllocationCacheMaxSize.set(MemoryConstants::pageSize64k);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_EQ(2u, svmManager->getNumAllocs());
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    svmManager->freeSVMAlloc(secondAllocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(secondAllocation));
+}
+
+TEST(SvmHostAllocationCacheTest, givenHostAndSharedCacheSizeLimitsWhenCreatingManagerThenEachCacheUsesItsOwnLimit) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    DebugManager.flags.ExperimentalHostAllocationCacheMaxSize.set(MemoryConstants::pageSize64k);
+    DebugManager.flags.ExperimentalSharedAllocationCacheMaxSize.set(MemoryConstants::pageSize64k * 2);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(deviceFactory->rootDevices[0]->getMemoryManager(), false);
+
+    EXPECT_EQ(MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache.maxCachedBytesPerDevice);
+    EXPECT_EQ(MemoryConstants::pageSize64k * 2, svmManager->usmSharedAllocationsCache.maxCachedBytesPerDevice);
+}
+
+TEST(SvmHostAllocationCacheTest, givenCacheSizeLimitWhenFreeingHostAllocationsOfDifferentRootDevicesThenTheyShareSingleBudget) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    DebugManager.flags.ExperimentalHostAllocationCacheMaxSize.set(MemoryConstants::pageSize64k);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(2, 1));
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(deviceFactory->rootDevices[0]->getMemoryManager(), false);
+
+    RootDeviceIndicesContainer firstRootDeviceIndices = {0u};
+    std::map<uint32_t, DeviceBitfield> firstDeviceBitfields{{0u, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties firstMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, firstRootDeviceIndices, firstDeviceBitfields);
+    RootDeviceIndicesContainer secondRootDeviceIndices = {1u};
+    std::map<uint32_t, DeviceBitfield> secondDeviceBitfields{{1u, mockDeviceBitfield}};
+    SVMAllocsManager::UnifiedMemoryProperties secondMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, secondRootDeviceIndices, secondDeviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, firstMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+    auto secondAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, secondMemoryProperties);
+    ASSERT_NE(nullptr, secondAllocation);
+
+    svmManager->freeSVMAlloc(allocation);
+    svmManager->freeSVMAlloc(secondAllocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.cachedBytesPerDevice.size());
+    EXPECT_EQ(MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache.cachedBytesPerDevice[nullptr]);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(secondAllocation));
+
+    svmManager->trimUSMHostAllocCaches();
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST(SvmHostAllocationCacheTest, givenHostAllocationWithExternalHostPointerWhenFreeingThenItIsNotCached) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SvmAllocationData svmData(mockRootDeviceIndex);
+    svmData.memoryType = InternalMemoryType::HOST_UNIFIED_MEMORY;
+    EXPECT_TRUE(svmManager->isHostAllocationCacheable(svmData));
+    svmData.allocationFlagsProperty.hostptr = 0x1000;
+    EXPECT_FALSE(svmManager->isHostAllocationCacheable(svmData));
+    svmData.allocationFlagsProperty.hostptr = 0u;
+    svmData.allocationFlagsProperty.flags.shareable = 1;
+    EXPECT_FALSE(svmManager->isHostAllocationCacheable(svmData));
+    svmData.allocationFlagsProperty.flags.shareable = 0;
+    svmData.isImportedAllocation = true;
+    EXPECT_FALSE(svmManager->isHostAllocationCacheable(svmData));
+}
+
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingSharedAllocationThenItIsReusedForSharedAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(0);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, allocation);
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(1u, svmManager->usmSharedAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+
+    SVMAllocsManager::UnifiedMemoryProperties hostMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto hostAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, hostMemoryProperties);
+    EXPECT_NE(allocation, hostAllocation);
+
+    auto secondAllocation = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    EXPECT_EQ(allocation, secondAllocation);
+    EXPECT_EQ(1u, svmManager->usmSharedAllocationsCache.hitCount);
+
+    svmManager->freeSVMAlloc(hostAllocation);
+    svmManager->freeSVMAlloc(secondAllocation);
+}
+
+TEST(SvmHostAllocationCacheTest, givenSharedAllocationsInCacheWhenDeviceAllocationFailsThenCachesAreTrimmedAndAllocationSucceeds) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(0);
+    auto device = deviceFactory->rootDevices[0];
+    device->injectMemoryManager(new MockMemoryManagerWithCapacity(*device->getExecutionEnvironment()));
+    MockMemoryManagerWithCapacity *memoryManager = static_cast<MockMemoryManagerWithCapacity *>(device->getMemoryManager());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+
+    memoryManager->capacity = MemoryConstants::pageSize64k * 2;
+
+    SVMAllocsManager::UnifiedMemoryProperties sharedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    sharedMemoryProperties.device = device;
+    auto allocationInCache = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, sharedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, allocationInCache);
+    svmManager->freeSVMAlloc(allocationInCache);
+    ASSERT_EQ(1u, svmManager->usmSharedAllocationsCache.allocations.size());
+
+    SVMAllocsManager::UnifiedMemoryProperties deviceMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    deviceMemoryProperties.device = device;
+    auto ptr = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, deviceMemoryProperties);
+    EXPECT_NE(nullptr, ptr);
+    EXPECT_EQ(0u, svmManager->usmSharedAllocationsCache.allocations.size());
+    svmManager->freeSVMAlloc(ptr);
+}
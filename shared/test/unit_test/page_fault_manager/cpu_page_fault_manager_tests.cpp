@@ -637,6 +637,29 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledTh
     unifiedMemoryManager->freeSVMAlloc(alloc1);
 }
 
+TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableRangeIsCalledThenOnlyThisRangeIsAubWritable) {
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+
+    auto properties = SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = unifiedMemoryManager->createSharedUnifiedMemoryAllocation(4 * MemoryConstants::pageSize, properties, cmdQ);
+
+    pageFaultManager->baseAubWritable(false, alloc1, unifiedMemoryManager.get());
+    pageFaultManager->baseAubWritableRange(alloc1, MemoryConstants::pageSize, MemoryConstants::pageSize, unifiedMemoryManager.get());
+
+    auto gpuAlloc = unifiedMemoryManager->getSVMAlloc(alloc1)->gpuAllocations.getGraphicsAllocation(mockRootDeviceIndex);
+    auto ranges = gpuAlloc->getAubWritableRanges(GraphicsAllocation::allBanks);
+    ASSERT_NE(nullptr, ranges);
+    ASSERT_EQ(1u, ranges->size());
+    EXPECT_EQ(MemoryConstants::pageSize, (*ranges)[0].first);
+    EXPECT_EQ(MemoryConstants::pageSize, (*ranges)[0].second);
+
+    unifiedMemoryManager->freeSVMAlloc(alloc1);
+}
+
 TEST_F(PageFaultManagerTest, givenAubOrTbxCsrWhenSelectingHandlerThenAubAndTbxGpuDomainHandlerIsSet) {
     DebugManagerStateRestore restorer;
 
@@ -755,3 +778,75 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenAllocationLargerThanMigrationChunkWhenVerifyingPagefaultThenOnlyFaultedChunkIsMigratedToCpuDomain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 3 * MemoryConstants::pageSize + 0x100;
+
+    pageFaultManager->insertAllocation(alloc, size, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->memoryData.at(alloc).chunkSize);
+    EXPECT_EQ(4u, pageFaultManager->memoryData.at(alloc).chunkDomains.size());
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, size);
+    EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 0u);
+
+    void *faultPtr = ptrOffset(alloc, 2 * MemoryConstants::pageSize + 0x10);
+    pageFaultManager->isAubWritable = false;
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(faultPtr));
+    EXPECT_FALSE(pageFaultManager->isAubWritable);
+    EXPECT_EQ(pageFaultManager->setAubWritableRangeCalled, 1);
+    EXPECT_EQ(pageFaultManager->aubWritableRangeOffset, 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(pageFaultManager->aubWritableRangeSize, MemoryConstants::pageSize);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, 2 * MemoryConstants::pageSize));
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, MemoryConstants::pageSize);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, ptrOffset(alloc, 2 * MemoryConstants::pageSize));
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, MemoryConstants::pageSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData.at(alloc).chunkDomains[1]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(alloc).chunkDomains[2]);
+    ASSERT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 1u);
+    EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs[0], alloc);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, size - 1)));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, 3 * MemoryConstants::pageSize));
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, 0x100u);
+    EXPECT_EQ(pageFaultManager->aubWritableRangeOffset, 3 * MemoryConstants::pageSize);
+    EXPECT_EQ(pageFaultManager->aubWritableRangeSize, 0x100u);
+    EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 1u);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, ptrOffset(alloc, 2 * MemoryConstants::pageSize));
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, MemoryConstants::pageSize + 0x100);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, ptrOffset(alloc, 2 * MemoryConstants::pageSize));
+    EXPECT_EQ(pageFaultManager->protectedSize, MemoryConstants::pageSize + 0x100);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 0u);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetToZeroWhenVerifyingPagefaultThenWholeAllocationIsMigrated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(0);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 4 * PageFaultManager::defaultMigrationChunkSize;
+
+    pageFaultManager->insertAllocation(alloc, size, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(alloc).chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc).chunkDomains.empty());
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, size / 2)));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, size);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, size);
+}
@@ -20,7 +20,7 @@ bool CompressionSelector::preferCompressedAllocation(const AllocationProperties
 }
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
-void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *allocPtr, void *cmdQ) {
 }
 CompilerCacheConfig getDefaultCompilerCacheConfig() { return {}; }
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) { return nullptr; }
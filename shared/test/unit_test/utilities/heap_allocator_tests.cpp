@@ -11,6 +11,8 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <random>
 
 using namespace NEO;
@@ -28,16 +30,15 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     uint64_t getRightBound() const { return this->pRightBound; }
     uint64_t getavailableSize() const { return this->availableSize; }
     size_t getThresholdSize() const { return this->sizeThreshold; }
-    using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec, size_t requiredAlignment) {
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &freedChunks, size_t requiredAlignment) {
         size_t sizeOfFreedChunk;
-        return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk, requiredAlignment);
+        return HeapAllocator::getFromFreedChunks(size, freedChunks, sizeOfFreedChunk, requiredAlignment);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &freedChunks) { return HeapAllocator::storeInFreedChunks(ptr, size, freedChunks); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    FreedChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    FreedChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
@@ -78,10 +79,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.store(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks, allocationAlignment);
 
@@ -94,15 +95,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x102000llu, 4096);
+    freedChunks.store(0x10e000llu, 4096);
+    freedChunks.store(0x10c000llu, 4096);
+    freedChunks.store(0x104000llu, 8192);
+    freedChunks.store(0x109000llu, 8192);
+    freedChunks.store(0x107000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -119,21 +120,22 @@ TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
+    // chunks are separated with a page so they are not merged
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.store(pUpperBound, 4096);
+    pUpperBound -= 6 * 4096;
+    freedChunks.store(pUpperBound, 5 * 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.store(pUpperBound, 4 * 4096);
     ptrExpected = pUpperBound;
 
-    pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    pUpperBound -= 6 * 4096;
+    freedChunks.store(pUpperBound, 5 * 4096);
+    pUpperBound -= 7 * 4096;
+    freedChunks.store(pUpperBound, 6 * 4096);
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -150,15 +152,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
+    pLowerBound += 10 * 4096;
+    freedChunks.store(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -170,8 +172,9 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(pLowerBound, chunks[2].ptr);
+    EXPECT_EQ(deltaSize, chunks[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -181,18 +184,18 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -205,8 +208,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -216,11 +219,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.store(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -228,11 +231,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -243,8 +246,27 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, freedChunks.getChunks()[1].ptr);
+    EXPECT_EQ(expectedSize, freedChunks.getChunks()[1].size);
+}
+
+TEST(HeapAllocatorTest, GivenStoredChunksOnBothSidesOfIncomingChunkWhenStoreIsCalledThenAllChunksAreMerged) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    FreedChunks freedChunks;
+
+    freedChunks.store(ptrBase, 4096);
+    freedChunks.store(ptrBase + 3 * 4096, 2 * 4096);
+
+    EXPECT_EQ(2u, freedChunks.size());
+
+    heapAllocator->storeInFreedChunks(ptrBase + 4096, 2 * 4096, freedChunks);
+
+    ASSERT_EQ(1u, freedChunks.size());
+    EXPECT_EQ(ptrBase, freedChunks.getChunks()[0].ptr);
+    EXPECT_EQ(5 * 4096u, freedChunks.getChunks()[0].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
@@ -254,11 +276,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -272,8 +294,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_EQ(ptrToStore, freedChunks.getChunks()[2].ptr);
+    EXPECT_EQ(sizeToStore, freedChunks.getChunks()[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCalledThenChunksAreMerged) {
@@ -281,10 +303,10 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x103000llu, 4096);
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x103000llu, 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -301,6 +323,26 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     EXPECT_EQ(1u, freedChunks.size());
 }
 
+TEST(HeapAllocatorTest, GivenStoredChunksWhenTakingChunksAdjacentToBoundsThenOnlyMatchingChunksAreRemoved) {
+    FreedChunks freedChunks;
+
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x104000llu, 2 * 4096);
+
+    size_t chunkSize = 0;
+    EXPECT_FALSE(freedChunks.takeChunkStartingAt(0x101000llu, chunkSize));
+    EXPECT_TRUE(freedChunks.takeChunkStartingAt(0x104000llu, chunkSize));
+    EXPECT_EQ(2 * 4096u, chunkSize);
+    EXPECT_EQ(1u, freedChunks.size());
+
+    uint64_t chunkPtr = 0;
+    EXPECT_FALSE(freedChunks.takeChunkEndingAt(0x100000llu, chunkPtr));
+    EXPECT_FALSE(freedChunks.takeChunkEndingAt(0x102000llu, chunkPtr));
+    EXPECT_TRUE(freedChunks.takeChunkEndingAt(0x101000llu, chunkPtr));
+    EXPECT_EQ(0x100000llu, chunkPtr);
+    EXPECT_TRUE(freedChunks.empty());
+}
+
 TEST(HeapAllocatorTest, WhenAllocatingThenEntryIsAddedToMap) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -755,6 +797,59 @@ TEST(HeapAllocatorTest, WhenMemoryIsAllocatedThenAllocationsDoNotOverlap) {
     alignedFree(pBasePtr);
 }
 
+TEST(HeapAllocatorTest, GivenRandomAllocationTraceWhenReplayedThenAllocationsDoNotOverlapAndWholeHeapIsRecovered) {
+    std::mt19937 generator(7);
+
+    const uint64_t heapBase = 0x100000000llu;
+    const uint64_t heapSize = 4 * MemoryConstants::gigaByte;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(heapBase, heapSize, MemoryConstants::pageSize);
+
+    const size_t allocationSizes[] = {MemoryConstants::pageSize, 2 * MemoryConstants::pageSize, MemoryConstants::pageSize64k,
+                                      MemoryConstants::megaByte, 2 * MemoryConstants::megaByte, 6 * MemoryConstants::megaByte,
+                                      16 * MemoryConstants::megaByte};
+    std::map<uint64_t, size_t> liveAllocations;
+
+    auto freeRandomAllocation = [&]() {
+        auto it = liveAllocations.begin();
+        std::advance(it, generator() % liveAllocations.size());
+        heapAllocator->free(it->first, it->second);
+        liveAllocations.erase(it);
+    };
+
+    for (uint32_t i = 0; i < 20000; i++) {
+        if (liveAllocations.empty() || (generator() % 3) != 0) {
+            size_t allocationSize = allocationSizes[generator() % (sizeof(allocationSizes) / sizeof(allocationSizes[0]))];
+            auto ptr = heapAllocator->allocate(allocationSize);
+            if (ptr == 0llu) {
+                freeRandomAllocation();
+                continue;
+            }
+
+            auto next = liveAllocations.lower_bound(ptr);
+            if (next != liveAllocations.end()) {
+                ASSERT_LE(ptr + allocationSize, next->first);
+            }
+            if (next != liveAllocations.begin()) {
+                auto previous = std::prev(next);
+                ASSERT_LE(previous->first + previous->second, ptr);
+            }
+            liveAllocations[ptr] = allocationSize;
+        } else {
+            freeRandomAllocation();
+        }
+    }
+
+    while (false == liveAllocations.empty()) {
+        freeRandomAllocation();
+    }
+
+    EXPECT_EQ(heapSize, heapAllocator->getavailableSize());
+    EXPECT_EQ(heapBase, heapAllocator->getLeftBound());
+    EXPECT_EQ(heapBase + heapSize, heapAllocator->getRightBound());
+    EXPECT_TRUE(heapAllocator->getFreedChunksSmall().empty());
+    EXPECT_TRUE(heapAllocator->getFreedChunksBig().empty());
+}
+
 TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000llu;
@@ -767,7 +862,7 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -794,21 +889,16 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
+    // 0, 1, 2 - merged on free
+    // 6, 7, 8, 10 - merged on free
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ(basePtr, chunks[0].ptr);
+    EXPECT_EQ(3 * allocSize, chunks[0].size);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((basePtr + 6 * allocSize), chunks[1].ptr);
+    EXPECT_EQ(5 * allocSize, chunks[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented) {
@@ -824,7 +914,7 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -851,21 +941,16 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
+    // 0, 1, 2 - merged on free
+    // 6, 7, 8, 10 - merged on free
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    auto chunks = freedChunks.getChunks();
+    EXPECT_EQ((upperLimitPtr - 10 * allocSize), chunks[0].ptr);
+    EXPECT_EQ(5 * allocSize, chunks[0].size);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((upperLimitPtr - 3 * allocSize), chunks[1].ptr);
+    EXPECT_EQ(3 * allocSize, chunks[1].size);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -875,7 +960,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -911,8 +996,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -972,8 +1057,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];